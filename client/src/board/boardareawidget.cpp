@@ -21,8 +21,10 @@
  */
 
 #include "boardareawidget.hpp"
+#include <algorithm>
 #include <cmath>
 #include <QPainter>
+#include <QPixmap>
 #include <QPaintEvent>
 #include <QtMath>
 #include <QApplication>
@@ -59,10 +61,25 @@ constexpr QRect updateTileRect(const int x, const int y, const int w, const int
   return QRect(x * (tileSize - 1) - 1, y * (tileSize - 1) - 1, 3 + w * (tileSize - 1), 3 + h * (tileSize - 1));
 }
 
+// everything that determines what a rendered tile looks like, except the settings
+static quint64 tileCacheKey(const TileData& data, uint8_t objectState, int tileSize)
+{
+  return
+    static_cast<quint64>(data.id()) | // 10 bit
+    (static_cast<quint64>(data.rotate()) << 10) | // 3 bit
+    (static_cast<quint64>(data.width()) << 13) |
+    (static_cast<quint64>(data.height()) << 21) |
+    (static_cast<quint64>(data.state) << 29) |
+    (static_cast<quint64>(objectState) << 37) |
+    (static_cast<quint64>(tileSize) << 45);
+}
+
 
 BoardAreaWidget::BoardAreaWidget(BoardWidget& board, QWidget* parent) :
   QWidget(parent),
   m_colorScheme{&BoardColorScheme::dark},
+  m_tileCache{tileCacheSize},
+  m_tileCacheDevicePixelRatio{0},
   m_board{board},
   m_boardLeft{board.board().getProperty("left")},
   m_boardTop{board.board().getProperty("top")},
@@ -187,6 +204,11 @@ void BoardAreaWidget::tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& obj
   }
 }
 
+void BoardAreaWidget::tileChanged(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+  update(updateTileRect(x - boardLeft(), y - boardTop(), width, height, getTileSize()));
+}
+
 void BoardAreaWidget::setGrid(Grid value)
 {
   if(m_grid != value)
@@ -222,6 +244,7 @@ void BoardAreaWidget::setZoomLevel(int value)
   {
     m_zoomLevel = value;
     updateMinimumSize();
+    updateViewport();
     update();
     emit zoomLevelChanged(m_zoomLevel);
   }
@@ -354,6 +377,46 @@ bool BoardAreaWidget::getNXButtonPressed(const TileLocation& l) const
   return false;
 }
 
+uint8_t BoardAreaWidget::getTileObjectState(TileId id, const TileLocation& l) const
+{
+  switch(id)
+  {
+    case TileId::RailTurnoutLeft45:
+    case TileId::RailTurnoutLeft90:
+    case TileId::RailTurnoutLeftCurved:
+    case TileId::RailTurnoutRight45:
+    case TileId::RailTurnoutRight90:
+    case TileId::RailTurnoutRightCurved:
+    case TileId::RailTurnoutWye:
+    case TileId::RailTurnout3Way:
+    case TileId::RailTurnoutSingleSlip:
+    case TileId::RailTurnoutDoubleSlip:
+      return static_cast<uint8_t>(getTurnoutPosition(l));
+
+    case TileId::RailSensor:
+      return static_cast<uint8_t>(getSensorState(l));
+
+    case TileId::RailSignal2Aspect:
+    case TileId::RailSignal3Aspect:
+      return static_cast<uint8_t>(getSignalAspect(l));
+
+    case TileId::RailDirectionControl:
+      return static_cast<uint8_t>(getDirectionControlState(l));
+
+    case TileId::PushButton:
+      return static_cast<uint8_t>(getColor(l));
+
+    case TileId::RailDecoupler:
+      return static_cast<uint8_t>(getDecouplerState(l));
+
+    case TileId::RailNXButton:
+      return (getNXButtonEnabled(l) ? 0x01 : 0x00) | (getNXButtonPressed(l) ? 0x02 : 0x00);
+
+    default:
+      return 0;
+  }
+}
+
 TileLocation BoardAreaWidget::pointToTileLocation(const QPoint& p)
 {
   const int pxPerTile = getTileSize() - 1;
@@ -468,6 +531,33 @@ void BoardAreaWidget::wheelEvent(QWheelEvent* event)
     QWidget::wheelEvent(event);
 }
 
+void BoardAreaWidget::resizeEvent(QResizeEvent* event)
+{
+  QWidget::resizeEvent(event);
+  updateViewport();
+}
+
+void BoardAreaWidget::showEvent(QShowEvent* event)
+{
+  QWidget::showEvent(event);
+  // the visible region is known after the widget is shown:
+  QMetaObject::invokeMethod(this, &BoardAreaWidget::updateViewport, Qt::QueuedConnection);
+}
+
+void BoardAreaWidget::updateViewport()
+{
+  const QRect visible = visibleRegion().boundingRect();
+  if(visible.isEmpty())
+    return;
+
+  const int gridSize = getTileSize() - 1;
+  m_board.board().setViewport(
+    boardLeft() + visible.left() / gridSize,
+    boardTop() + visible.top() / gridSize,
+    boardLeft() + visible.right() / gridSize,
+    boardTop() + visible.bottom() / gridSize);
+}
+
 void BoardAreaWidget::paintEvent(QPaintEvent* event)
 {
   assert(m_colorScheme);
@@ -519,92 +609,44 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
 
   painter.save();
 
-  for(auto it : m_board.board().tileData())
-    if(it.first.x + it.second.width() - 1 >= tiles.left() && it.first.x <= tiles.right() &&
-        it.first.y + it.second.height() - 1 >= tiles.top() && it.first.y <= tiles.bottom())
+  const qreal devicePixelRatio = devicePixelRatioF();
+  const int tileOverflow = TilePainter::overflow(tileSize);
+  if(m_tileCacheDevicePixelRatio != devicePixelRatio)
+  {
+    m_tileCache.clear();
+    m_tileCacheDevicePixelRatio = devicePixelRatio;
+  }
+
+  m_board.board().forEachTile(tiles.left(), tiles.top(), tiles.right(), tiles.bottom(),
+    [&](const TileLocation& l, const TileData& data)
     {
-      if(it.first == m_mouseMoveHideTileLocation)
-        continue;
+      if(l == m_mouseMoveHideTileLocation)
+        return;
 
-      const TileId id = it.second.id();
-      const TileRotate a = it.second.rotate();
-      const uint8_t state = it.second.state;
-      const bool isReserved = (state != 0);
-      painter.setBrush(Qt::NoBrush);
+      const QRectF r = drawTileRect(l.x - tileOriginX, l.y - tileOriginY, data.width(), data.height(), tileSize);
+      const uint8_t objectState = getTileObjectState(data.id(), l);
 
-      const QRectF r = drawTileRect(it.first.x - tileOriginX, it.first.y - tileOriginY, it.second.width(), it.second.height(), tileSize);
-      switch(id)
+      if(data.id() == TileId::RailBlock) // shows the block name and trains, not cached
       {
-        case TileId::RailStraight:
-        case TileId::RailCurve45:
-        case TileId::RailCurve90:
-        case TileId::RailBufferStop:
-        case TileId::RailTunnel:
-        case TileId::RailOneWay:
-        case TileId::RailLink:
-          tilePainter.draw(id, r, a, isReserved);
-          break;
-
-        case TileId::RailTurnoutLeft45:
-        case TileId::RailTurnoutLeft90:
-        case TileId::RailTurnoutLeftCurved:
-        case TileId::RailTurnoutRight45:
-        case TileId::RailTurnoutRight90:
-        case TileId::RailTurnoutRightCurved:
-        case TileId::RailTurnoutWye:
-        case TileId::RailTurnout3Way:
-        case TileId::RailTurnoutSingleSlip:
-        case TileId::RailTurnoutDoubleSlip:
-          tilePainter.drawTurnout(id, r, a, static_cast<TurnoutPosition>(state), getTurnoutPosition(it.first));
-          break;
-
-        case TileId::RailCross45:
-        case TileId::RailCross90:
-          tilePainter.drawCross(id, r, a, static_cast<CrossState>(state));
-          break;
-
-        case TileId::RailBridge45Left:
-        case TileId::RailBridge45Right:
-        case TileId::RailBridge90:
-          tilePainter.drawBridge(id, r, a, state & 0x01, state & 0x02);
-          break;
-
-        case TileId::RailSensor:
-          tilePainter.drawSensor(id, r, a, isReserved, getSensorState(it.first));
-          break;
-
-        case TileId::RailSignal2Aspect:
-        case TileId::RailSignal3Aspect:
-          tilePainter.drawSignal(id, r, a, isReserved, getSignalAspect(it.first));
-          break;
-
-        case TileId::RailBlock:
-          tilePainter.drawBlock(id, r, a, state & 0x01, state & 0x02, m_board.board().getTileObject(it.first));
-          break;
-
-        case TileId::RailDirectionControl:
-          tilePainter.drawDirectionControl(id, r, a, isReserved, getDirectionControlState(it.first));
-          break;
-
-        case TileId::PushButton:
-          tilePainter.drawPushButton(r, getColor(it.first));
-          break;
-
-        case TileId::RailDecoupler:
-          tilePainter.drawRailDecoupler(r, a, isReserved, getDecouplerState(it.first));
-          break;
-
-        case TileId::RailNXButton:
-          tilePainter.drawRailNX(r, a, isReserved, getNXButtonEnabled(it.first), getNXButtonPressed(it.first));
-          break;
-
-        case TileId::None:
-        case TileId::ReservedForFutureExpension:
-        default:
-          assert(false);
-          break;
+        painter.setBrush(Qt::NoBrush);
+        drawTile(tilePainter, r, l, data, objectState);
+        return;
       }
-    }
+
+      // rendered tiles are padded, drawings may extend beyond the tile rect:
+      const QPointF topLeft = r.topLeft() - QPointF(tileOverflow, tileOverflow);
+      const quint64 key = tileCacheKey(data, objectState, tileSize);
+      if(const QPixmap* pixmap = m_tileCache.object(key))
+      {
+        painter.drawPixmap(topLeft, *pixmap);
+      }
+      else
+      {
+        const QPixmap tile = renderTile(l, data, objectState, tileSize, devicePixelRatio);
+        painter.drawPixmap(topLeft, tile);
+        m_tileCache.insert(key, new QPixmap(tile), std::max(1, tile.width() * tile.height() * tile.depth() / 8 / 1024));
+      }
+    });
 
   painter.restore();
 
@@ -659,11 +701,109 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
   }
 }
 
+void BoardAreaWidget::drawTile(TilePainter& tilePainter, const QRectF& r, const TileLocation& l, const TileData& data, uint8_t objectState)
+{
+  const TileId id = data.id();
+  const TileRotate a = data.rotate();
+  const uint8_t state = data.state;
+  const bool isReserved = (state != 0);
+
+  switch(id)
+  {
+    case TileId::RailStraight:
+    case TileId::RailCurve45:
+    case TileId::RailCurve90:
+    case TileId::RailBufferStop:
+    case TileId::RailTunnel:
+    case TileId::RailOneWay:
+    case TileId::RailLink:
+      tilePainter.draw(id, r, a, isReserved);
+      break;
+
+    case TileId::RailTurnoutLeft45:
+    case TileId::RailTurnoutLeft90:
+    case TileId::RailTurnoutLeftCurved:
+    case TileId::RailTurnoutRight45:
+    case TileId::RailTurnoutRight90:
+    case TileId::RailTurnoutRightCurved:
+    case TileId::RailTurnoutWye:
+    case TileId::RailTurnout3Way:
+    case TileId::RailTurnoutSingleSlip:
+    case TileId::RailTurnoutDoubleSlip:
+      tilePainter.drawTurnout(id, r, a, static_cast<TurnoutPosition>(state), static_cast<TurnoutPosition>(objectState));
+      break;
+
+    case TileId::RailCross45:
+    case TileId::RailCross90:
+      tilePainter.drawCross(id, r, a, static_cast<CrossState>(state));
+      break;
+
+    case TileId::RailBridge45Left:
+    case TileId::RailBridge45Right:
+    case TileId::RailBridge90:
+      tilePainter.drawBridge(id, r, a, state & 0x01, state & 0x02);
+      break;
+
+    case TileId::RailSensor:
+      tilePainter.drawSensor(id, r, a, isReserved, static_cast<SensorState>(objectState));
+      break;
+
+    case TileId::RailSignal2Aspect:
+    case TileId::RailSignal3Aspect:
+      tilePainter.drawSignal(id, r, a, isReserved, static_cast<SignalAspect>(objectState));
+      break;
+
+    case TileId::RailBlock:
+      tilePainter.drawBlock(id, r, a, state & 0x01, state & 0x02, m_board.board().getTileObject(l));
+      break;
+
+    case TileId::RailDirectionControl:
+      tilePainter.drawDirectionControl(id, r, a, isReserved, static_cast<DirectionControlState>(objectState));
+      break;
+
+    case TileId::PushButton:
+      tilePainter.drawPushButton(r, static_cast<Color>(objectState));
+      break;
+
+    case TileId::RailDecoupler:
+      tilePainter.drawRailDecoupler(r, a, isReserved, static_cast<DecouplerState>(objectState));
+      break;
+
+    case TileId::RailNXButton:
+      tilePainter.drawRailNX(r, a, isReserved, objectState & 0x01, objectState & 0x02);
+      break;
+
+    case TileId::None:
+    case TileId::ReservedForFutureExpension:
+    default:
+      assert(false);
+      break;
+  }
+}
+
+QPixmap BoardAreaWidget::renderTile(const TileLocation& l, const TileData& data, uint8_t objectState, int tileSize, qreal devicePixelRatio)
+{
+  const int overflow = TilePainter::overflow(tileSize);
+  const QRectF r = drawTileRect(0, 0, data.width(), data.height(), tileSize).translated(overflow, overflow);
+
+  QPixmap pixmap(qCeil((r.width() + 2 * overflow) * devicePixelRatio), qCeil((r.height() + 2 * overflow) * devicePixelRatio));
+  pixmap.setDevicePixelRatio(devicePixelRatio);
+  pixmap.fill(Qt::transparent);
+
+  QPainter painter(&pixmap);
+  painter.setRenderHint(QPainter::Antialiasing, true);
+  TilePainter tilePainter{painter, tileSize, *m_colorScheme};
+  drawTile(tilePainter, r, l, data, objectState);
+
+  return pixmap;
+}
+
 void BoardAreaWidget::settingsChanged()
 {
   const auto& s = BoardSettings::instance();
 
   m_colorScheme = getBoardColorScheme(s.colorScheme.value());
+  m_tileCache.clear(); // color scheme and tile painter settings aren't part of the key
 
   update();
 }
@@ -675,5 +815,6 @@ void BoardAreaWidget::updateMinimumSize()
   const int height = 1 + tileSize * (1 + boardBottom() - boardTop());
 
   setMinimumSize(width, height);
+  updateViewport(); // board origin may have changed
   update();
 }
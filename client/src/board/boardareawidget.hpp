@@ -24,7 +24,10 @@
 #define TRAINTASTIC_CLIENT_BOARD_BOARDAREAWIDGET_HPP
 
 #include <QWidget>
+#include <QCache>
+#include <QPixmap>
 #include <traintastic/board/tileid.hpp>
+#include <traintastic/board/tiledata.hpp>
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/enum/tilerotate.hpp>
 #include <traintastic/enum/decouplerstate.hpp>
@@ -39,6 +42,7 @@
 #include "../network/objectptr.hpp"
 
 class BoardWidget;
+class TilePainter;
 
 class BoardAreaWidget : public QWidget
 {
@@ -61,7 +65,11 @@ class BoardAreaWidget : public QWidget
     };
 
   private:
+    static constexpr int tileCacheSize = 32 * 1024; //!< KiB
+
     const BoardColorScheme* m_colorScheme;
+    QCache<quint64, QPixmap> m_tileCache; //!< rendered tiles, cost is size in KiB
+    qreal m_tileCacheDevicePixelRatio;
 
   protected:
     static constexpr int boardMargin = 1; // tile
@@ -104,6 +112,10 @@ class BoardAreaWidget : public QWidget
     DecouplerState getDecouplerState(const TileLocation& l) const;
     bool getNXButtonEnabled(const TileLocation& l) const;
     bool getNXButtonPressed(const TileLocation& l) const;
+    //! \brief Object state the tile drawing depends on, e.g. turnout position
+    uint8_t getTileObjectState(TileId id, const TileLocation& l) const;
+    void drawTile(TilePainter& tilePainter, const QRectF& r, const TileLocation& l, const TileData& data, uint8_t objectState);
+    QPixmap renderTile(const TileLocation& l, const TileData& data, uint8_t objectState, int tileSize, qreal devicePixelRatio);
     TileLocation pointToTileLocation(const QPoint& p);
 
     void leaveEvent(QEvent *event) final;
@@ -112,6 +124,8 @@ class BoardAreaWidget : public QWidget
     void mouseReleaseEvent(QMouseEvent* event) final;
     void mouseMoveEvent(QMouseEvent* event) final;
     void wheelEvent(QWheelEvent* event) final;
+    void resizeEvent(QResizeEvent* event) final;
+    void showEvent(QShowEvent* event) final;
     void paintEvent(QPaintEvent* event) final;
 
   protected slots:
@@ -141,10 +155,14 @@ class BoardAreaWidget : public QWidget
 
   public slots:
     void tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& object);
+    void tileChanged(int16_t x, int16_t y, uint8_t width, uint8_t height);
     void setGrid(Grid value);
     void setZoomLevel(int value);
     void zoomIn() { setZoomLevel(zoomLevel() + 1); }
     void zoomOut() { setZoomLevel(zoomLevel() - 1); }
+    //! \brief Request the tiles of the visible part of the board
+    //! Must be called when scrolling, zooming or resizing changed the visible part.
+    void updateViewport();
 
   signals:
     void gridChanged(Grid);
@@ -29,6 +29,7 @@
 #include <QAction>
 #include <QActionGroup>
 #include <QScrollArea>
+#include <QScrollBar>
 #include <QStatusBar>
 #include <QLabel>
 #include <QApplication>
@@ -355,6 +356,13 @@ BoardWidget::BoardWidget(std::shared_ptr<Board> object, QWidget* parent) :
   sa->setWidget(m_boardArea);
   l->addWidget(sa);
 
+  // the visible part of the board changes when scrolled or when the scroll area is resized:
+  for(QScrollBar* scrollBar : {sa->horizontalScrollBar(), sa->verticalScrollBar()})
+  {
+    connect(scrollBar, &QScrollBar::valueChanged, m_boardArea, &BoardAreaWidget::updateViewport);
+    connect(scrollBar, &QScrollBar::rangeChanged, m_boardArea, &BoardAreaWidget::updateViewport);
+  }
+
   m_statusBar->addWidget(m_statusBarMessage, 1);
   m_statusBar->addWidget(m_statusBarCoords, 0);
   m_statusBar->addWidget(m_statusBarZoom, 0);
@@ -367,8 +375,6 @@ BoardWidget::BoardWidget(std::shared_ptr<Board> object, QWidget* parent) :
 
   setLayout(l);
 
-  m_object->getTileData();
-
   m_nxManagerRequestId = m_object->connection()->getObject("world.nx_manager",
     [this](const ObjectPtr& nxManager, std::optional<const Error> /*error*/)
     {
@@ -381,6 +387,7 @@ BoardWidget::BoardWidget(std::shared_ptr<Board> object, QWidget* parent) :
     });
 
   connect(m_object.get(), &Board::tileDataChanged, this, [this](){ m_boardArea->update(); });
+  connect(m_object.get(), &Board::tileChanged, m_boardArea, &BoardAreaWidget::tileChanged);
   connect(m_object.get(), &Board::tileObjectAdded, m_boardArea, &BoardAreaWidget::tileObjectAdded);
   connect(m_boardArea, &BoardAreaWidget::gridChanged, this, &BoardWidget::gridChanged);
   connect(m_boardArea, &BoardAreaWidget::zoomLevelChanged, this, &BoardWidget::zoomLevelChanged);
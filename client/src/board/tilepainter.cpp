@@ -37,7 +37,7 @@ TilePainter::TilePainter(QPainter& painter, int tileSize, const BoardColorScheme
   m_colorScheme{colorScheme},
   m_showBlockSensorStates{BoardSettings::instance().showBlockSensorStates},
   m_turnoutDrawState{BoardSettings::instance().turnoutDrawState},
-  m_trackWidth{tileSize / 5},
+  m_trackWidth{trackWidth(tileSize)},
   m_turnoutMargin{tileSize / 10},
   m_blockPen{m_colorScheme.track},
   m_trackPen(m_colorScheme.track, m_trackWidth, Qt::SolidLine, Qt::FlatCap),
@@ -95,6 +95,11 @@ class TilePainter
     void drawRailBlock(const QRectF& r, TileRotate rotate, bool isReservedA = false, bool isReservedB = false, const ObjectPtr& blockTile = {});
 
   public:
+    static constexpr int trackWidth(int tileSize) { return tileSize / 5; }
+    //! \brief Distance a tile drawing may extend beyond its rect
+    //! Strokes with flat caps at the corners, e.g. 45 degree rails or the bridge erase pen of twice the track width.
+    static constexpr int overflow(int tileSize) { return trackWidth(tileSize) + 1; }
+
     TilePainter(QPainter& painter, int tileSize, const BoardColorScheme& colorScheme);
 
     void draw(TileId id, const QRectF& r, TileRotate rotate, bool isReserved = false);
@@ -147,7 +147,7 @@ void ConnectDialog::socketReadyRead()
 
     if(message.command() == Message::Command::Discover && message.isResponse() && !message.isError())
     {
-      QString name = QString::fromUtf8(message.read<QByteArray>());
+      QString name = message.read<QString>();
 
       QUrl url;
       url.setHost(host.toString());
@@ -407,6 +407,11 @@ MainWindow::MainWindow(QWidget* parent) :
       {
         showObject("traintastic.settings", Locale::tr("qtapp.mainmenu:server_settings"));
       });
+    m_actionServerDiagnostics = m_menuServer->addAction(Locale::tr("qtapp.mainmenu:server_diagnostics") + "...", this,
+      [this]()
+      {
+        showObject("traintastic.diagnostics", Locale::tr("qtapp.mainmenu:server_diagnostics"));
+      });
     m_menuServer->addSeparator();
     m_actionServerRestart = m_menuServer->addAction(Locale::tr("qtapp.mainmenu:restart_server"), this,
       [this]()
@@ -635,6 +640,12 @@ void MainWindow::worldChanged()
 
     m_world = m_connection->world();
 
+    if(m_world)
+    {
+      // the clock is requested below and the NX manager by every board window, get both using a single request:
+      m_connection->prefetchObjects({"world.clock", "world.nx_manager"});
+    }
+
     m_clockRequest = m_connection->getObject("world.clock",
       [this](const ObjectPtr& object, std::optional<const Error> error)
       {
@@ -904,6 +915,7 @@ void MainWindow::updateActions()
   m_actionServerLog->setEnabled(connected);
   m_menuServer->setEnabled(connected);
   m_actionServerSettings->setEnabled(connected);
+  m_actionServerDiagnostics->setEnabled(connected);
   if(connected)
   {
     Method* m;
@@ -88,6 +88,7 @@ class MainWindow final : public QMainWindow
     QAction* m_actionClock;
     QMenu* m_menuServer;
     QAction* m_actionServerSettings;
+    QAction* m_actionServerDiagnostics;
     QAction* m_actionServerRestart;
     QAction* m_actionServerShutdown;
     QAction* m_actionServerLog;
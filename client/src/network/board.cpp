@@ -23,55 +23,73 @@
 #include "board.hpp"
 #include "connection.hpp"
 #include "callmethod.hpp"
+#include <algorithm>
 
 std::vector<Board::TileInfo> Board::tileInfo;
 
 Board::Board(std::shared_ptr<Connection> connection, Handle handle) :
   Object(std::move(connection), handle, classId),
-  m_getTileDataRequestId{Connection::invalidRequestId}
+  m_viewport{{0, 0}, {-1, -1}}
 {
 }
 
 Board::~Board()
 {
-  if(m_getTileDataRequestId != Connection::invalidRequestId)
-    if(auto c = connection())
-      c->cancelRequest(m_getTileDataRequestId);
+  if(auto c = connection())
+    for(int requestId : m_getTileChunksRequestIds)
+      c->cancelRequest(requestId);
 }
 
-void Board::getTileData()
+void Board::setViewport(int left, int top, int right, int bottom)
 {
-  m_getTileDataRequestId = m_connection->getTileData(*this);
+  const TileChunkRect viewport = TileChunkRect::fromTiles(left, top, right, bottom);
+  if(viewport == m_viewport)
+    return;
+
+  // drop tiles that are no longer visible, the server stops sending changes for them:
+  bool changed = false;
+  for(auto it = m_tileData.begin(); it != m_tileData.end();)
+  {
+    if(!viewport.contains(it->first))
+    {
+      m_tileObjects.erase(it->first);
+      it = eraseTileData(it);
+      changed = true;
+    }
+    else
+      ++it;
+  }
+
+  std::vector<TileChunk> chunks;
+  for(int y = viewport.min.y; y <= viewport.max.y; y++)
+    for(int x = viewport.min.x; x <= viewport.max.x; x++)
+      if(const TileChunk chunk{static_cast<int16_t>(x), static_cast<int16_t>(y)}; !m_viewport.contains(chunk))
+        chunks.emplace_back(chunk);
+
+  m_viewport = viewport;
+  m_connection->setBoardViewport(*this, m_viewport);
+  if(!chunks.empty())
+    m_getTileChunksRequestIds.append(m_connection->getTileChunks(*this, chunks));
+
+  if(changed)
+    emit tileDataChanged();
 }
 
 bool Board::getTileOrigin(TileLocation& l) const
 {
-  if(auto it = m_tileData.find(l); it != m_tileData.end())
+  if(auto it = findTile(l); it != m_tileData.end())
+  {
+    l = it->first;
     return true;
-
-  for(const auto& it : m_tileData)
-    if(l.x >= it.first.x && l.x < it.first.x + it.second.width() &&
-        l.y >= it.first.y && l.y < it.first.y + it.second.height())
-    {
-      l = it.first;
-      return true;
-    }
-
+  }
   return false;
 }
 
 TileId Board::getTileId(TileLocation l) const
 {
-  if(auto it = m_tileData.find(l); it != m_tileData.end())
+  if(auto it = findTile(l); it != m_tileData.end())
     return it->second.id();
 
-  for(const auto& it : m_tileData)
-    if(l.x >= it.first.x && l.x < it.first.x + it.second.width() &&
-        l.y >= it.first.y && l.y < it.first.y + it.second.height())
-    {
-      return it.second.id();
-    }
-
   return TileId::None;
 }
 
@@ -80,10 +98,8 @@ ObjectPtr Board::getTileObject(TileLocation l) const
   auto itObject = m_tileObjects.find(l);
 
   if(itObject == m_tileObjects.end())
-    for(const auto& itData : m_tileData)
-      if(l.x >= itData.first.x && l.x < itData.first.x + itData.second.width() &&
-          l.y >= itData.first.y && l.y < itData.first.y + itData.second.height())
-        itObject = m_tileObjects.find(itData.first);
+    if(auto itData = findTile(l); itData != m_tileData.end())
+      itObject = m_tileObjects.find(itData->first);
 
   if(itObject != m_tileObjects.end())
     return itObject->second;
@@ -111,17 +127,60 @@ int Board::deleteTile(int16_t x, int16_t y, std::function<void(const bool&, std:
   return ::callMethod(*m_connection, *getMethod("delete_tile"), std::move(callback), x, y);
 }
 
-void Board::getTileDataResponse(const Message& response)
+Board::TileDataMap::const_iterator Board::findTile(TileLocation l) const
+{
+  if(auto it = m_tileData.find(l); it != m_tileData.end())
+    return it;
+
+  auto it = m_tileData.end();
+  forEachTile(l.x, l.y, l.x, l.y,
+    [this, &it](const TileLocation& origin, const TileData& /*data*/)
+    {
+      it = m_tileData.find(origin);
+    });
+  return it;
+}
+
+void Board::setTileData(TileLocation l, const TileData& data)
+{
+  if(m_tileData.insert_or_assign(l, data).second) // inserted
+    m_tileChunks[chunkKey(TileChunk::fromLocation(l))].emplace_back(l);
+}
+
+Board::TileDataMap::iterator Board::eraseTileData(TileDataMap::iterator it)
+{
+  if(auto chunk = m_tileChunks.find(chunkKey(TileChunk::fromLocation(it->first))); chunk != m_tileChunks.end())
+  {
+    auto& origins = chunk->second;
+    if(auto origin = std::find(origins.begin(), origins.end(), it->first); origin != origins.end())
+    {
+      *origin = origins.back();
+      origins.pop_back();
+    }
+    if(origins.empty())
+      m_tileChunks.erase(chunk);
+  }
+  return m_tileData.erase(it);
+}
+
+void Board::getTileChunksResponse(const Message& response)
 {
-  m_getTileDataRequestId = Connection::invalidRequestId;
+  m_getTileChunksRequestIds.removeOne(response.requestId());
 
   while(!response.endOfMessage())
   {
     TileLocation l = response.read<TileLocation>();
     TileData data = response.read<TileData>();
-    m_tileData.emplace(l, data);
+    ObjectPtr object;
     if(data.isActive())
-      emit tileObjectAdded(l.x, l.y, m_tileObjects.emplace(l, m_connection->readObject(response)).first->second);
+      object = m_connection->readObject(response);
+
+    if(!m_viewport.contains(l)) // scrolled out of view while requesting
+      continue;
+
+    setTileData(l, data);
+    if(object)
+      emit tileObjectAdded(l.x, l.y, m_tileObjects.insert_or_assign(l, std::move(object)).first->second);
   }
 
   emit tileDataChanged();
@@ -135,14 +194,23 @@ void Board::processMessage(const Message& message)
     {
       TileLocation l = message.read<TileLocation>();
       TileData data = message.read<TileData>();
-      if(!data) // no tile
+      if(!m_viewport.contains(l)) // sent before the server received the new viewport
       {
-        auto it = m_tileData.find(l);
-        if(it != m_tileData.end())
-          m_tileData.erase(it);
+        if(data.isActive())
+          m_connection->readObject(message); // keep handle counter in sync
+        break;
       }
-      else
-        m_tileData[l] = data;
+      uint8_t width = data ? data.width() : 1;
+      uint8_t height = data ? data.height() : 1;
+      if(auto it = m_tileData.find(l); it != m_tileData.end())
+      {
+        width = std::max(width, it->second.width());
+        height = std::max(height, it->second.height());
+        if(!data) // no tile
+          eraseTileData(it);
+      }
+      if(data)
+        setTileData(l, data);
 
       if(data.isPassive())
       {
@@ -156,7 +224,7 @@ void Board::processMessage(const Message& message)
         emit tileObjectAdded(l.x, l.y, m_tileObjects[l]);
       }
 
-      emit tileDataChanged();
+      emit tileChanged(l.x, l.y, width, height);
       break;
     }
     default:
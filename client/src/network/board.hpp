@@ -26,10 +26,12 @@
 #include "object.hpp"
 #include <QString>
 #include <unordered_map>
+#include <vector>
 #include <optional>
 #include <traintastic/enum/tristate.hpp>
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/board/tiledata.hpp>
+#include <traintastic/board/tilechunk.hpp>
 #include "objectptr.hpp"
 
 struct Error;
@@ -54,12 +56,26 @@ class Board final : public Object
 
     static std::vector<TileInfo> tileInfo;
 
+  private:
+    static uint32_t chunkKey(const TileChunk& chunk)
+    {
+      return (static_cast<uint32_t>(static_cast<uint16_t>(chunk.y)) << 16) | static_cast<uint16_t>(chunk.x);
+    }
+
+    //! \brief Find the tile covering \a l
+    TileDataMap::const_iterator findTile(TileLocation l) const;
+
   protected:
-    TileDataMap m_tileData;
-    TileObjectMap m_tileObjects;
-    int m_getTileDataRequestId;
+    TileDataMap m_tileData; //!< only tiles within \ref m_viewport
+    std::unordered_map<uint32_t, std::vector<TileLocation>> m_tileChunks; //!< tile origins by chunk, index of \ref m_tileData
+    TileObjectMap m_tileObjects; //!< only tiles within \ref m_viewport
+    TileChunkRect m_viewport;
+    QVector<int> m_getTileChunksRequestIds;
 
-    void getTileDataResponse(const Message& response);
+    void setTileData(TileLocation l, const TileData& data);
+    TileDataMap::iterator eraseTileData(TileDataMap::iterator it);
+
+    void getTileChunksResponse(const Message& response);
     void processMessage(const Message& message) final;
 
   public:
@@ -68,9 +84,27 @@ class Board final : public Object
     Board(std::shared_ptr<Connection> connection, Handle handle);
     ~Board() final;
 
-    void getTileData();
+    //! \brief Set visible tiles, tiles that become visible are requested from the server
+    void setViewport(int left, int top, int right, int bottom);
     const TileDataMap& tileData() const { return m_tileData; }
 
+    //! \brief Call \a f for each tile covering at least one cell of the inclusive rectangle
+    template<class F>
+    void forEachTile(int left, int top, int right, int bottom, F&& f) const
+    {
+      // a tile belongs to the chunk of its origin, start one chunk left and above for large tiles:
+      const auto chunks = TileChunkRect::fromTiles(left, top, right, bottom);
+      for(int y = chunks.min.y; y <= chunks.max.y; y++)
+        for(int x = chunks.min.x; x <= chunks.max.x; x++)
+          if(auto it = m_tileChunks.find(chunkKey({static_cast<int16_t>(x), static_cast<int16_t>(y)})); it != m_tileChunks.end())
+            for(const TileLocation& l : it->second)
+            {
+              const TileData& data = m_tileData.find(l)->second;
+              if(l.x + data.width() - 1 >= left && l.x <= right && l.y + data.height() - 1 >= top && l.y <= bottom)
+                f(l, data);
+            }
+    }
+
     const TileObjectMap& tileObjects() const { return m_tileObjects; }
 
     bool getTileOrigin(TileLocation& l) const;
@@ -84,6 +118,8 @@ class Board final : public Object
 
   signals:
     void tileDataChanged();
+    //! \brief Tile at \a x, \a y is added, changed or removed, \a width and \a height cover the old and new tile
+    void tileChanged(int16_t x, int16_t y, uint8_t width, uint8_t height);
     void tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& object);
 };
 
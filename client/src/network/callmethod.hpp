@@ -61,7 +61,7 @@ inline R getResult(Connection& connection, const Message& message)
   else if constexpr(value_type_v<R> == ValueType::Float)
     return message.read<double>();
   else if constexpr(value_type_v<R> == ValueType::String)
-    return QString::fromUtf8(message.read<QByteArray>());
+    return message.read<QString>();
   else if constexpr(value_type_v<R> == ValueType::Object)
     return connection.readObject(message);
   else
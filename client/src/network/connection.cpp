@@ -21,9 +21,11 @@
  */
 
 #include "connection.hpp"
+#include <limits>
 #include <QTcpSocket>
 #include <QUrl>
 #include <QCryptographicHash>
+#include <QTimer>
 #include <traintastic/network/message.hpp>
 #include "serverlogtablemodel.hpp"
 #include "object.hpp"
@@ -58,7 +60,7 @@ inline static QVariant readValue(const Message& message, const ValueType valueTy
       return message.read<double>();
 
     case ValueType::String:
-      return QString::fromUtf8(message.read<QByteArray>());
+      return message.read<QString>();
 
     case ValueType::Object:
       return QString::fromLatin1(message.read<QByteArray>());
@@ -99,7 +101,7 @@ inline static QList<QVariant> readArray(const Message& message, const ValueType
 
     case ValueType::String:
       for(int i = 0; i < length; i++)
-        values.append(QString::fromUtf8(message.read<QByteArray>()));
+        values.append(message.read<QString>());
       break;
 
     case ValueType::Object:
@@ -216,6 +218,52 @@ int Connection::getObject(const QString& id, std::function<void(const ObjectPtr&
 {
   std::unique_ptr<Message> request{Message::newRequest(Message::Command::GetObject)};
   request->write(id.toLatin1());
+
+  if(auto it = m_prefetched.find(id); it != m_prefetched.end())
+  {
+    // answer from the prefetched objects, but asynchronous like a request sent to the server, so it can be cancelled:
+    const uint16_t requestId = request->requestId();
+    m_requestCallback[requestId] =
+      [callback, object=it.value()](const std::shared_ptr<Message>& /*message*/)
+      {
+        callback(object, {});
+      };
+    QMetaObject::invokeMethod(this,
+      [this, requestId]()
+      {
+        answerRequest(requestId);
+      }, Qt::QueuedConnection);
+    return requestId;
+  }
+
+  if(m_prefetching.contains(id))
+  {
+    // wait for the prefetch response, only send the request if the prefetch didn't get the object:
+    const uint16_t requestId = request->requestId();
+    m_requestCallback[requestId] =
+      [this, id, requestId, callback](const std::shared_ptr<Message>& /*message*/)
+      {
+        if(ObjectPtr object = m_prefetched.value(id))
+        {
+          callback(object, {});
+        }
+        else
+        {
+          auto retry = std::make_unique<Message>(Message::Command::GetObject, Message::Type::Request, requestId);
+          retry->write(id.toLatin1());
+          sendGetObject(retry, callback);
+        }
+      };
+    m_prefetchWaiting.insert(id, requestId);
+    return requestId;
+  }
+
+  sendGetObject(request, std::move(callback));
+  return request->requestId();
+}
+
+void Connection::sendGetObject(std::unique_ptr<Message>& request, std::function<void(const ObjectPtr&, std::optional<const Error>)> callback)
+{
   send(request,
     [this, callback](const std::shared_ptr<Message> message)
     {
@@ -228,7 +276,6 @@ int Connection::getObject(const QString& id, std::function<void(const ObjectPtr&
         callback({}, *message);
       }
     });
-  return request->requestId();
 }
 
 int Connection::getObject(const ObjectProperty& property, std::function<void(const ObjectPtr&, std::optional<const Error>)> callback)
@@ -299,6 +346,83 @@ int Connection::getObjects(const ObjectVectorProperty& property, uint32_t startI
   return request->requestId();
 }
 
+int Connection::getObjects(const QStringList& ids, std::function<void(const std::vector<ObjectPtr>&, std::optional<const Error>)> callback)
+{
+  std::unique_ptr<Message> request{Message::newRequest(Message::Command::GetObjects)};
+  request->write(static_cast<Message::Length>(ids.size()));
+  for(const auto& id : ids)
+    request->write(id.toLatin1());
+  send(request,
+    [this, callback](const std::shared_ptr<Message> message)
+    {
+      if(!message->isError())
+      {
+        const auto count = message->read<Message::Length>();
+        std::vector<ObjectPtr> objects;
+        objects.reserve(count);
+        for(Message::Length i = 0; i < count; i++)
+          objects.emplace_back(message->read<bool>() ? readObject(*message) : ObjectPtr());
+        callback(objects, {});
+      }
+      else
+      {
+        callback({}, *message);
+      }
+    });
+  return request->requestId();
+}
+
+void Connection::prefetchObjects(const QStringList& ids)
+{
+  QStringList missing;
+  for(const auto& id : ids)
+    if(!m_prefetched.contains(id) && !m_prefetching.contains(id))
+      missing.append(id);
+
+  if(missing.isEmpty())
+    return;
+
+  for(const auto& id : missing)
+    m_prefetching.insert(id);
+
+  (void)getObjects(missing,
+    [this, missing](const std::vector<ObjectPtr>& objects, std::optional<const Error> /*error*/)
+    {
+      for(int i = 0; i < missing.size(); i++)
+      {
+        m_prefetching.remove(missing[i]);
+        if(static_cast<size_t>(i) < objects.size() && objects[i])
+          m_prefetched.insert(missing[i], objects[i]);
+      }
+
+      // answer waiting requests:
+      for(const auto& id : missing)
+      {
+        for(uint16_t requestId : m_prefetchWaiting.values(id))
+          answerRequest(requestId);
+        m_prefetchWaiting.remove(id);
+      }
+
+      QTimer::singleShot(prefetchHoldTime, this,
+        [this, missing]()
+        {
+          for(const auto& id : missing)
+            m_prefetched.remove(id);
+        });
+    });
+}
+
+void Connection::answerRequest(uint16_t requestId)
+{
+  // the request may be cancelled in the mean time:
+  if(auto it = m_requestCallback.find(requestId); it != m_requestCallback.end())
+  {
+    auto callback = std::move(it.value());
+    m_requestCallback.erase(it);
+    callback({});
+  }
+}
+
 void Connection::setUnitPropertyUnit(UnitProperty& property, int64_t value)
 {
   auto event = Message::newEvent(Message::Command::ObjectSetUnitPropertyUnit);
@@ -428,14 +552,35 @@ void Connection::setTableModelRegion(TableModel* tableModel, int columnMin, int
   send(event);
 }
 
-int Connection::getTileData(Board& object)
+void Connection::setTableModelSortFilter(TableModel* tableModel, int sortColumn, bool descending, const QString& filter)
+{
+  auto event = Message::newEvent(Message::Command::TableModelSetSortFilter);
+  event->write(tableModel->handle());
+  event->write(sortColumn >= 0 ? static_cast<uint32_t>(sortColumn) : std::numeric_limits<uint32_t>::max());
+  event->write(descending);
+  event->write(filter.toUtf8());
+  send(event);
+}
+
+void Connection::setBoardViewport(Board& board, const TileChunkRect& viewport)
+{
+  auto event = Message::newEvent(Message::Command::BoardSetViewport);
+  event->write(board.handle());
+  event->write(viewport);
+  send(event);
+}
+
+int Connection::getTileChunks(Board& board, const std::vector<TileChunk>& chunks)
 {
-  auto request = Message::newRequest(Message::Command::BoardGetTileData);
-  request->write(object.handle());
+  auto request = Message::newRequest(Message::Command::BoardGetTileChunks);
+  request->write(board.handle());
+  request->write(static_cast<uint32_t>(chunks.size()));
+  for(const auto& chunk : chunks)
+    request->write(chunk);
   send(request,
-    [&object](const std::shared_ptr<Message> message)
+    [&board](const std::shared_ptr<Message> message)
     {
-      object.getTileDataResponse(*message);
+      board.getTileChunksResponse(*message);
     });
   return request->requestId();
 }
@@ -619,7 +764,7 @@ ObjectPtr Connection::readObject(const Message& message)
                   break;
 
                 case ValueType::String:
-                  value = QString::fromUtf8(message.read<QByteArray>());
+                  value = message.read<QString>();
                   break;
 
                 case ValueType::Object:
@@ -702,6 +847,7 @@ void Connection::setWorld(const ObjectPtr& world)
 {
   if(m_world != world)
   {
+    m_prefetched.clear();
     m_world = world;
     emit worldChanged();
   }
@@ -788,7 +934,7 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
               }
               case ValueType::String:
               {
-                const QString value = QString::fromUtf8(message->read<QByteArray>());
+                const QString value = message->read<QString>();
                 static_cast<Property*>(property)->m_value = value;
                 emit property->valueChanged();
                 emit property->valueChangedString(value);
@@ -848,7 +994,7 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
                     break;
 
                   case ValueType::String:
-                    value = QString::fromUtf8(message->read<QByteArray>());
+                    value = message->read<QString>();
                     break;
 
                   case ValueType::Object:
@@ -893,7 +1039,7 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
                   case ValueType::String:
                   {
                     for(int i = 0; i < length; i++)
-                      values.append(QString::fromUtf8(message->read<QByteArray>()));
+                      values.append(message->read<QString>());
                     break;
                   }
                   case ValueType::Object:
@@ -929,7 +1075,7 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
           const int columnCount = message->read<int>();
           model->m_columnHeaders.clear();
           for(int i = 0; i < columnCount; i++)
-            model->m_columnHeaders.push_back(QString::fromUtf8(message->read<QByteArray>()));
+            model->m_columnHeaders.push_back(message->read<QString>());
           Q_ASSERT(model->m_columnHeaders.size() == columnCount);
         }
         break;
@@ -947,18 +1093,33 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
           const uint32_t rowMin = message->read<uint32_t>();
           const uint32_t rowMax = message->read<uint32_t>();
 
-          model->beginResetModel();
-
           TableModel::ColumnRow index;
           QByteArray data;
           for(index.second = rowMin; index.second <= rowMax; index.second++)
+          {
+            message->read(data);
+            model->m_rowIds[index.second] = QString::fromUtf8(data);
             for(index.first = columnMin; index.first <= columnMax; index.first++)
             {
               message->read(data);
               model->m_texts[index] = Locale::instance->parse(QString::fromUtf8(data));
             }
+          }
 
-          model->endResetModel();
+          if(static_cast<int>(rowMin) < model->rowCount())
+            emit model->dataChanged(
+              model->index(rowMin, columnMin),
+              model->index(std::min<int>(rowMax, model->rowCount() - 1), std::min<int>(columnMax, model->columnCount() - 1)));
+        }
+        break;
+
+      case Message::Command::TableModelRowsChanged:
+        if(TableModel* model = m_tableModels.value(message->read<Handle>(), nullptr))
+        {
+          const auto change = message->read<TableModelRowChange>();
+          const auto row = message->read<uint32_t>();
+          const auto value = message->read<uint32_t>();
+          model->changeRows(change, row, value);
         }
         break;
 
@@ -991,6 +1152,7 @@ void Connection::socketConnected()
   std::unique_ptr<Message> loginRequest{Message::newRequest(Message::Command::Login)};
   loginRequest->write(m_username.toUtf8());
   loginRequest->write(m_password);
+  loginRequest->write<Message::Features>(Message::featureCompression);
   send(loginRequest,
     [this](const std::shared_ptr<Message> loginResponse)
     {
@@ -1071,6 +1233,21 @@ void Connection::socketError(QAbstractSocket::SocketError)
   setState(State::SocketError);
 }
 
+std::shared_ptr<Message> Connection::uncompress(const Message& message)
+{
+  // data has the same format as qCompress output, see Message::featureCompression
+  const QByteArray data = qUncompress(static_cast<const uchar*>(message.data()), static_cast<int>(message.dataSize()));
+  if(data.isEmpty())
+    return {};
+
+  Message::Header header = *static_cast<const Message::Header*>(*message);
+  header.flags.compressed = 0;
+  header.dataSize = static_cast<uint32_t>(data.size());
+  auto uncompressed = std::make_shared<Message>(header);
+  memcpy(uncompressed->data(), data.constData(), header.dataSize);
+  return uncompressed;
+}
+
 void Connection::socketReadyRead()
 {
   while(m_socket->bytesAvailable() != 0)
@@ -1092,7 +1269,20 @@ void Connection::socketReadyRead()
       m_readBuffer.offset += m_socket->read(reinterpret_cast<char*>(m_readBuffer.message->data()) + m_readBuffer.offset, m_readBuffer.message->dataSize() - m_readBuffer.offset);
       if(m_readBuffer.offset == m_readBuffer.message->dataSize())
       {
-        processMessage(m_readBuffer.message);
+        if(m_readBuffer.message->isCompressed())
+        {
+          auto message = uncompress(*m_readBuffer.message);
+          if(!message)
+          {
+            m_readBuffer.message.reset();
+            m_readBuffer.offset = 0;
+            m_socket->disconnectFromHost();
+            return;
+          }
+          processMessage(message);
+        }
+        else
+          processMessage(m_readBuffer.message);
         m_readBuffer.message.reset();
         m_readBuffer.offset = 0;
       }
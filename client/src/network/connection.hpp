@@ -27,8 +27,13 @@
 #include <memory>
 #include <unordered_map>
 #include <optional>
+#include <vector>
 #include <QAbstractSocket>
 #include <QMap>
+#include <QHash>
+#include <QMultiHash>
+#include <QSet>
+#include <QStringList>
 #include <QUuid>
 #include <traintastic/network/message.hpp>
 #include "handle.hpp"
@@ -47,6 +52,8 @@ class OutputKeyboard;
 class Board;
 class OutputMap;
 struct Error;
+struct TileChunk;
+struct TileChunkRect;
 
 class Connection : public QObject, public std::enable_shared_from_this<Connection>
 {
@@ -91,6 +98,9 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
     ObjectProperty* m_worldProperty;
     int m_worldRequestId;
     ObjectPtr m_world;
+    QHash<QString, ObjectPtr> m_prefetched; //!< prefetched objects by id, kept for \ref prefetchHoldTime
+    QSet<QString> m_prefetching; //!< ids of objects being prefetched
+    QMultiHash<QString, uint16_t> m_prefetchWaiting; //!< getObject requests waiting for a prefetch, by id
     ServerLogTableModel* m_serverLogTableModel;
     QMap<Handle, std::weak_ptr<Object>> m_objects;
     std::unordered_map<Handle, uint32_t> m_handleCounter;
@@ -99,8 +109,11 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
 
     void setState(State state);
     void processMessage(const std::shared_ptr<Message> message);
+    static std::shared_ptr<Message> uncompress(const Message& message);
 
     ObjectPtr readObject(const Message &message);
+    void sendGetObject(std::unique_ptr<Message>& request, std::function<void(const ObjectPtr&, std::optional<const Error>)> callback);
+    void answerRequest(uint16_t requestId);
     TableModelPtr readTableModel(const Message& message);
 
     void getWorld();
@@ -115,6 +128,7 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
   public:
     static const quint16 defaultPort = 5740;
     static constexpr int invalidRequestId = -1;
+    static constexpr int prefetchHoldTime = 30'000; //!< ms
 
     Connection();
 
@@ -142,6 +156,16 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
     [[nodiscard]] int getObject(const ObjectProperty& property, std::function<void(const ObjectPtr&, std::optional<const Error>)> callback);
     [[nodiscard]] int getObject(const ObjectVectorProperty& property, uint32_t index, std::function<void(const ObjectPtr&, std::optional<const Error>)> callback);
     [[nodiscard]] int getObjects(const ObjectVectorProperty& property, uint32_t startIndex, uint32_t endIndex, std::function<void(const std::vector<ObjectPtr>&, std::optional<const Error>)> callback);
+    [[nodiscard]] int getObjects(const QStringList& ids, std::function<void(const std::vector<ObjectPtr>&, std::optional<const Error>)> callback);
+
+    /**
+     * \brief Get multiple objects using a single request
+     *
+     * The objects are kept for \ref prefetchHoldTime, \ref getObject(const QString&, std::function<void(const ObjectPtr&, std::optional<const Error>)>)
+     * uses them instead of sending a request, the callback is still called from the event loop.
+     * Requests for objects that are still being prefetched are answered when the prefetch response arrives.
+     */
+    void prefetchObjects(const QStringList& ids);
     void releaseObject(Object* object);
 
     void setUnitPropertyUnit(UnitProperty& property, int64_t value);
@@ -156,8 +180,10 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
     [[nodiscard]] int getTableModel(const ObjectPtr& object, std::function<void(const TableModelPtr&, std::optional<const Error>)> callback);
     void releaseTableModel(TableModel* tableModel);
     void setTableModelRegion(TableModel* tableModel, int columnMin, int columnMax, int rowMin, int rowMax);
+    void setTableModelSortFilter(TableModel* tableModel, int sortColumn, bool descending, const QString& filter);
 
-    [[nodiscard]] int getTileData(Board& object);
+    void setBoardViewport(Board& board, const TileChunkRect& viewport);
+    [[nodiscard]] int getTileChunks(Board& board, const std::vector<TileChunk>& chunks);
 
   signals:
     void stateChanged();
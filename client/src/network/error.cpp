@@ -31,7 +31,7 @@ Error::Error(const Message& msg)
   const auto count = msg.read<Message::Length>();
   for(Message::Length i = 0; i < count; ++i)
   {
-    args.emplace_back(QString::fromUtf8(msg.read<QByteArray>()));
+    args.emplace_back(msg.read<QString>());
   }
 }
 
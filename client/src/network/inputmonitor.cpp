@@ -74,7 +74,7 @@ void InputMonitor::processMessage(const Message& message)
       while(count > 0)
       {
         const uint32_t address = message.read<uint32_t>();
-        const QString id = QString::fromUtf8(message.read<QByteArray>());
+        const QString id = message.read<QString>();
         const TriState value = message.read<TriState>();
         m_inputIds[address] = id;
         m_inputValues[address] = value;
@@ -87,7 +87,7 @@ void InputMonitor::processMessage(const Message& message)
     case Message::Command::InputMonitorInputIdChanged:
     {
       const uint32_t address = message.read<uint32_t>();
-      const QString id = QString::fromUtf8(message.read<QByteArray>());
+      const QString id = message.read<QString>();
       m_inputIds[address] = id;
       emit inputIdChanged(address, id);
       return;
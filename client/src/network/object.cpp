@@ -166,7 +166,7 @@ void Object::processMessage(const Message& message)
 
             case ValueType::String:
             case ValueType::Object:
-              arguments.push_back(QString::fromUtf8(message.read<QByteArray>()));
+              arguments.push_back(message.read<QString>());
               break;
 
             default:
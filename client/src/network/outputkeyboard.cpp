@@ -76,7 +76,7 @@ void OutputKeyboard::processMessage(const Message& message)
       while(count > 0)
       {
         const uint32_t address = message.read<uint32_t>();
-        const QString id = QString::fromUtf8(message.read<QByteArray>());
+        const QString id = message.read<QString>();
         const TriState value = message.read<TriState>();
         m_outputIds[address] = id;
         m_outputValues[address] = value;
@@ -89,7 +89,7 @@ void OutputKeyboard::processMessage(const Message& message)
     case Message::Command::OutputKeyboardOutputIdChanged:
     {
       const uint32_t address = message.read<uint32_t>();
-      const QString id = QString::fromUtf8(message.read<QByteArray>());
+      const QString id = message.read<QString>();
       m_outputIds[address] = id;
       emit outputIdChanged(address, id);
       return;
@@ -120,7 +120,7 @@ void ServerLogTableModel::processMessage(const Message& message)
     log.message = Locale::tr("message:" + logMessageCode(log.code));
     const int argc = message.read<uint8_t>();
     for(int j = 0; j < argc; j++)
-      log.message = log.message.arg(QString::fromUtf8(message.read<QByteArray>()));
+      log.message = log.message.arg(message.read<QString>());
     m_logs.append(log);
   }
 
@@ -60,11 +60,7 @@ QVariant TableModel::data(const QModelIndex& index, int role) const
 
 QString TableModel::getRowObjectId(int row) const
 {
-  // TODO: rename to get row id and get it from the server
-  if(m_classId == "world_list_table_model")
-    return m_texts.value(ColumnRow(1, row));
-  else
-    return m_texts.value(ColumnRow(0, row));
+  return m_rowIds.value(static_cast<uint32_t>(row));
 }
 
 QString TableModel::getValue(int column, int row) const
@@ -88,6 +84,25 @@ void TableModel::setRegion(int columnMin, int columnMax, int rowMin, int rowMax)
   }
 }
 
+void TableModel::sort(int column, Qt::SortOrder order)
+{
+  if(m_sortColumn != column || m_sortOrder != order)
+  {
+    m_sortColumn = column;
+    m_sortOrder = order;
+    m_connection->setTableModelSortFilter(this, m_sortColumn, m_sortOrder == Qt::DescendingOrder, m_filter);
+  }
+}
+
+void TableModel::setFilter(const QString& value)
+{
+  if(m_filter != value)
+  {
+    m_filter = value;
+    m_connection->setTableModelSortFilter(this, m_sortColumn, m_sortOrder == Qt::DescendingOrder, m_filter);
+  }
+}
+
 void TableModel::setColumnHeaders(const QVector<QString>& values)
 {
   if(m_columnHeaders != values)
@@ -107,3 +122,74 @@ void TableModel::setRowCount(int value)
     endResetModel();
   }
 }
+
+template<class Func>
+void TableModel::remapRows(Func&& map)
+{
+  QMap<ColumnRow, QString> texts;
+  for(auto it = m_texts.cbegin(); it != m_texts.cend(); ++it)
+    if(const int r = map(static_cast<int>(it.key().second)); r >= 0)
+      texts.insert(ColumnRow(it.key().first, static_cast<uint32_t>(r)), it.value());
+  m_texts.swap(texts);
+
+  QMap<uint32_t, QString> rowIds;
+  for(auto it = m_rowIds.cbegin(); it != m_rowIds.cend(); ++it)
+    if(const int r = map(static_cast<int>(it.key())); r >= 0)
+      rowIds.insert(static_cast<uint32_t>(r), it.value());
+  m_rowIds.swap(rowIds);
+}
+
+void TableModel::changeRows(TableModelRowChange change, uint32_t row, uint32_t value)
+{
+  const int first = static_cast<int>(row);
+
+  switch(change)
+  {
+    case TableModelRowChange::Insert:
+    {
+      const int count = static_cast<int>(value);
+      beginInsertRows(QModelIndex(), first, first + count - 1);
+      remapRows([first, count](int r) { return r >= first ? r + count : r; });
+      m_rowCount += count;
+      endInsertRows();
+      break;
+    }
+    case TableModelRowChange::Remove:
+    {
+      const int count = static_cast<int>(value);
+      beginRemoveRows(QModelIndex(), first, first + count - 1);
+      remapRows(
+        [first, count](int r)
+        {
+          if(r < first)
+            return r;
+          if(r < first + count)
+            return -1; // removed
+          return r - count;
+        });
+      m_rowCount -= count;
+      endRemoveRows();
+      break;
+    }
+    case TableModelRowChange::Move:
+    {
+      const int to = static_cast<int>(value);
+      if(beginMoveRows(QModelIndex(), first, first, QModelIndex(), to > first ? to + 1 : to))
+      {
+        remapRows(
+          [first, to](int r)
+          {
+            if(r == first)
+              return to;
+            if(first < to && r > first && r <= to)
+              return r - 1;
+            if(to < first && r >= to && r < first)
+              return r + 1;
+            return r;
+          });
+        endMoveRows();
+      }
+      break;
+    }
+  }
+}
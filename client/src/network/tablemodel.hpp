@@ -25,6 +25,7 @@
 
 #include <QAbstractTableModel>
 #include <memory>
+#include <traintastic/enum/tablemodelrowchange.hpp>
 #include "handle.hpp"
 
 class Connection;
@@ -51,9 +52,16 @@ class TableModel final : public QAbstractTableModel
       int columnMax = -1;
     } m_region;
     QMap<ColumnRow, QString> m_texts;
+    QMap<uint32_t, QString> m_rowIds;
+    int m_sortColumn = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+    QString m_filter;
 
     void setColumnHeaders(const QVector<QString>& values);
     void setRowCount(int value);
+    void changeRows(TableModelRowChange change, uint32_t row, uint32_t value);
+    template<class Func>
+    void remapRows(Func&& map);
 
   public:
     explicit TableModel(std::shared_ptr<Connection> connection, Handle handle, const QString& classId, QObject* parent = nullptr);
@@ -68,10 +76,14 @@ class TableModel final : public QAbstractTableModel
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const final;
     QVariant data(const QModelIndex& index, int role) const final;
 
+    //! \brief Id of the object shown in the row, empty if unknown or not an object
     QString getRowObjectId(int row) const;
     QString getValue(int column, int row) const;
 
     void setRegion(int columnMin, int columnMax, int rowMin, int rowMax);
+
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) final;
+    void setFilter(const QString& value);
 };
 
 #endif
@@ -24,6 +24,8 @@
 #include <QVBoxLayout>
 #include <QToolBar>
 #include <QTableView>
+#include <QHeaderView>
+#include <QLineEdit>
 #include <traintastic/locale/locale.hpp>
 #include "../tablewidget.hpp"
 #include "../../network/connection.hpp"
@@ -399,6 +401,21 @@ ObjectListWidget::ObjectListWidget(const ObjectPtr& object_, QWidget* parent) :
         m_toolbar->addAction(stopAll);
     }
   }
+
+  if(!m_actionMoveUp && !m_actionMoveDown && !m_actionReverse)
+  {
+    // list order has no meaning, rows can be sorted and filtered by the server:
+    m_tableWidget->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+    m_tableWidget->setSortingEnabled(true);
+
+    auto* filter = new QLineEdit(m_toolbar);
+    filter->setPlaceholderText(Locale::tr("list:filter"));
+    filter->setClearButtonEnabled(true);
+    filter->setMaximumWidth(fontMetrics().averageCharWidth() * 30);
+    connect(filter, &QLineEdit::textChanged, m_tableWidget, &TableWidget::setFilter);
+    m_toolbar->addSeparator();
+    m_toolbar->addWidget(filter);
+  }
 }
 
 ObjectListWidget::~ObjectListWidget()
@@ -57,6 +57,8 @@ void TableWidget::setTableModel(const TableModelPtr& model)
   Q_ASSERT(!m_model);
   m_model = model;
   setModel(m_model.get());
+  if(!m_filter.isEmpty())
+    m_model->setFilter(m_filter);
 
   const int defaultWidth = fontMetrics().averageCharWidth() * 10;
   QList<QVariant> columnSizes = QSettings().value(m_model->classId() + "/column_sizes").toList();
@@ -67,17 +69,39 @@ void TableWidget::setTableModel(const TableModelPtr& model)
     [this]()
     {
       m_selectedRow = -1;
+      m_selectedObjectId.clear();
       if(const auto* sm = selectionModel())
         if(auto rows = sm->selectedRows(); rows.size() == 1)
+        {
           m_selectedRow = rows[0].row();
+          m_selectedObjectId = m_model->getRowObjectId(m_selectedRow);
+        }
     });
   connect(m_model.get(), &TableModel::modelReset, this,
     [this]()
     {
       updateRegion();
-      if(m_selectedRow != -1)
+      if(m_selectedObjectId.isEmpty() && m_selectedRow != -1)
         selectRow(m_selectedRow);
     });
+  connect(m_model.get(), &TableModel::dataChanged, this,
+    [this](const QModelIndex& topLeft, const QModelIndex& bottomRight)
+    {
+      if(m_selectedObjectId.isEmpty())
+        return;
+      for(int row = topLeft.row(); row <= bottomRight.row(); row++)
+        if(m_model->getRowObjectId(row) == m_selectedObjectId)
+        {
+          m_selectedObjectId.clear();
+          selectRow(row);
+          break;
+        }
+    });
+  connect(selectionModel(), &QItemSelectionModel::selectionChanged, this,
+    [this]()
+    {
+      m_selectedObjectId.clear(); // selected by the user
+    });
   connect(horizontalScrollBar(), &QScrollBar::rangeChanged, this, &TableWidget::updateRegion);
   connect(horizontalScrollBar(), &QScrollBar::valueChanged, this, &TableWidget::updateRegion);
   connect(verticalScrollBar(), &QScrollBar::rangeChanged, this, &TableWidget::updateRegion);
@@ -86,6 +110,13 @@ void TableWidget::setTableModel(const TableModelPtr& model)
   updateRegion();
 }
 
+void TableWidget::setFilter(const QString& value)
+{
+  m_filter = value;
+  if(m_model)
+    m_model->setFilter(m_filter);
+}
+
 void TableWidget::updateRegion()
 {
   const int columnCount = m_model->columnCount();
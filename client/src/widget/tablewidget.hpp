@@ -33,6 +33,8 @@ class TableWidget : public QTableView
   protected:
     TableModelPtr m_model;
     int m_selectedRow = -1;
+    QString m_selectedObjectId; //!< selected object to restore after a reset, rows can move when the server sorts
+    QString m_filter;
 
   protected slots:
     void updateRegion();
@@ -44,6 +46,9 @@ class TableWidget : public QTableView
     QString getRowObjectId(int row) const;
 
     void setTableModel(const TableModelPtr& model);
+
+    //! \brief Only show rows containing the text, filtering is done by the server
+    void setFilter(const QString& value);
 };
 
 #endif
@@ -0,0 +1,50 @@
+/**
+ * server/benchmark/benchmark.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BENCHMARK_BENCHMARK_HPP
+#define TRAINTASTIC_SERVER_BENCHMARK_BENCHMARK_HPP
+
+#include <cstddef>
+#include "../src/utils/json.hpp"
+
+//! \brief Micro benchmarks of server components, each returns its results as JSON
+namespace Benchmark {
+
+//! \brief Number of heap allocations since program start
+//! Counted by the benchmark's replacement of the global operator new.
+size_t allocations();
+
+//! \brief Compare \ref EventLoop::call with \ref EventLoopQueue for bursts of kernel events
+nlohmann::json eventLoopQueue();
+
+//! \brief Compare encoding a property changed event per session with sharing one encoded event
+nlohmann::json objectPropertyChanged();
+
+//! \brief Encode and decode throughput of pooled messages
+nlohmann::json message();
+
+//! \brief Compare \ref TileGrid with a hash map of tile locations for a full board
+nlohmann::json tileGrid();
+
+}
+
+#endif
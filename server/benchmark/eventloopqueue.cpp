@@ -0,0 +1,118 @@
+/**
+ * server/benchmark/eventloopqueue.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "benchmark.hpp"
+#include <atomic>
+#include <functional>
+#include <thread>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/eventloopqueue.hpp"
+
+namespace Benchmark {
+
+nlohmann::json eventLoopQueue()
+{
+  // events arrive in bursts, like a kernel receiving a batch of messages:
+  static constexpr size_t bursts = 10'000;
+  static constexpr size_t burstSize = 100;
+  static constexpr size_t events = bursts * burstSize;
+  using Clock = EventLoopStatistics::Clock;
+
+  // producer thread simulates a kernel, consumer thread the event loop:
+  const auto run =
+    [](auto&& makePost) -> nlohmann::json
+    {
+      boost::asio::io_context ioContext;
+      auto post = makePost(ioContext);
+      auto work = std::make_unique<boost::asio::io_context::work>(ioContext);
+      std::thread consumer([&ioContext]() { ioContext.run(); });
+
+      Clock::duration latency{};
+      std::atomic<size_t> handled = 0;
+      const auto handler =
+        [&latency, &handled](uint32_t address, bool value, Clock::time_point posted)
+        {
+          (void)address;
+          (void)value;
+          latency += Clock::now() - posted;
+          handled.fetch_add(1, std::memory_order_release);
+        };
+
+      const size_t allocationsStart = allocations();
+      const auto start = Clock::now();
+      for(size_t burst = 0; burst < bursts; burst++)
+      {
+        for(size_t i = 0; i < burstSize; i++)
+          post(handler, static_cast<uint32_t>(i), (i & 1) != 0);
+        while(handled.load(std::memory_order_acquire) != (burst + 1) * burstSize)
+          std::this_thread::yield();
+      }
+      const auto duration = Clock::now() - start;
+      const size_t allocationsEnd = allocations();
+
+      ioContext.post([&work]() { work.reset(); });
+      consumer.join();
+
+      using std::chrono::nanoseconds;
+      nlohmann::json result = nlohmann::json::object();
+      result["allocations_per_event"] = static_cast<double>(allocationsEnd - allocationsStart) / events;
+      result["ns_per_event"] = std::chrono::duration_cast<nanoseconds>(duration).count() / events;
+      result["latency_ns_per_event"] = std::chrono::duration_cast<nanoseconds>(latency).count() / events;
+      return result;
+    };
+
+  nlohmann::json result = nlohmann::json::object();
+  result["events"] = events;
+  result["burst_size"] = burstSize;
+
+  // same as EventLoop::call, but using the benchmark's io_context:
+  result["event_loop_call"] = run(
+    [](boost::asio::io_context& ioContext)
+    {
+      return
+        [&ioContext](const auto& handler, uint32_t address, bool value)
+        {
+          EventLoop::statistics.posted();
+          ioContext.post(
+            [f=std::bind(handler, address, value, Clock::now()), posted=Clock::now()]() mutable
+            {
+              const auto started = Clock::now();
+              f();
+              EventLoop::statistics.handled(posted, started);
+            });
+        };
+    });
+
+  result["event_loop_queue"] = run(
+    [](boost::asio::io_context& ioContext)
+    {
+      return
+        [queue=std::make_shared<EventLoopQueue>(ioContext)](const auto& handler, uint32_t address, bool value)
+        {
+          queue->call([&handler, address, value, posted=Clock::now()]() { handler(address, value, posted); });
+        };
+    });
+
+  return result;
+}
+
+}
@@ -0,0 +1,267 @@
+/**
+ * server/benchmark/main.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <boost/program_options.hpp>
+#ifdef __linux__
+  #include <malloc.h>
+  #include <unistd.h>
+#endif
+#include <version.hpp>
+#include "benchmark.hpp"
+#include "worldgenerator.hpp"
+#include "../src/world/world.hpp"
+#include "../src/world/worldjournal.hpp"
+#include "../src/world/worldloader.hpp"
+#include "../src/world/worldsaver.hpp"
+#include "../src/world/worldstatecheckpoint.hpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+
+using nlohmann::json;
+using SteadyClock = std::chrono::steady_clock;
+
+//! \return Allocated heap memory in bytes if available, else the resident set size, 0 if neither is available
+//! \note The resident set size doesn't shrink when memory is freed, so it only measures a first allocation.
+static size_t memoryUsage()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#elif defined(__linux__)
+  std::ifstream file("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  if(file >> size >> resident)
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+  return 0;
+}
+
+static json memory(size_t before, size_t after)
+{
+  if(before == 0 || after == 0)
+    return nullptr;
+  return after > before ? after - before : 0;
+}
+
+//! \brief Run \a function \a iterations times and report duration in milliseconds
+template<class F>
+static json measure(unsigned int iterations, F&& function)
+{
+  std::vector<double> durations;
+  for(unsigned int i = 0; i < iterations; i++)
+  {
+    const auto start = SteadyClock::now();
+    function();
+    durations.emplace_back(std::chrono::duration<double, std::milli>(SteadyClock::now() - start).count());
+  }
+
+  json result = json::object();
+  result["first_ms"] = durations.front();
+  result["min_ms"] = *std::min_element(durations.begin(), durations.end());
+  result["max_ms"] = *std::max_element(durations.begin(), durations.end());
+  double total = 0;
+  for(double duration : durations)
+    total += duration;
+  result["mean_ms"] = total / durations.size();
+  return result;
+}
+
+static uintmax_t diskSize(const std::filesystem::path& path)
+{
+  if(std::filesystem::is_regular_file(path))
+    return std::filesystem::file_size(path);
+
+  uintmax_t size = 0;
+  for(const auto& entry : std::filesystem::recursive_directory_iterator(path))
+    if(entry.is_regular_file())
+      size += entry.file_size();
+  return size;
+}
+
+int main(int argc, char* argv[])
+{
+  WorldGenerator::Config config;
+  unsigned int iterations = 5;
+  std::string dir = (std::filesystem::temp_directory_path() / "traintastic-benchmark").string();
+  std::string output;
+
+  {
+    namespace po = boost::program_options;
+    po::options_description desc{"Options for traintastic-server-benchmark"};
+    desc.add_options()
+      ("help,h", "display this help text and exit")
+      ("boards", po::value<uint32_t>(&config.boards)->default_value(config.boards), "number of boards")
+      ("tiles", po::value<uint32_t>(&config.tiles)->default_value(config.tiles), "number of rail tiles per board")
+      ("blocks", po::value<uint32_t>(&config.blocks)->default_value(config.blocks), "number of blocks per board")
+      ("decoders", po::value<uint32_t>(&config.decoders)->default_value(config.decoders), "number of decoders")
+      ("inputs", po::value<uint32_t>(&config.inputs)->default_value(config.inputs), "number of inputs")
+      ("outputs", po::value<uint32_t>(&config.outputs)->default_value(config.outputs), "number of outputs")
+      ("trains", po::value<uint32_t>(&config.trains)->default_value(config.trains), "number of trains")
+      ("scripts", po::value<uint32_t>(&config.scripts)->default_value(config.scripts), "number of scripts")
+      ("iterations,n", po::value<unsigned int>(&iterations)->default_value(iterations), "number of iterations per measurement")
+      ("dir", po::value<std::string>(&dir)->value_name("PATH"), "directory for saved worlds")
+      ("output,o", po::value<std::string>(&output)->value_name("FILENAME"), "write results to file instead of stdout")
+      ;
+
+    po::variables_map vm;
+    try
+    {
+      po::store(po::parse_command_line(argc, argv, desc), vm);
+      po::notify(vm);
+    }
+    catch(const std::exception& e)
+    {
+      std::cerr << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if(vm.count("help"))
+    {
+      std::cout << desc << std::endl;
+      return EXIT_SUCCESS;
+    }
+
+    if(iterations == 0)
+      iterations = 1;
+  }
+
+  json result = json::object();
+  result["version"] = TRAINTASTIC_VERSION_FULL;
+  result["config"] = config.toJSON();
+  result["iterations"] = iterations;
+
+  try
+  {
+    std::filesystem::create_directories(dir);
+
+    // generate:
+    std::shared_ptr<World> world;
+    {
+      const size_t memoryBefore = memoryUsage();
+      result["generate"] = measure(1,
+        [&world, &config]()
+        {
+          world = WorldGenerator::generate(config);
+        });
+      result["generate"]["memory_bytes"] = memory(memoryBefore, memoryUsage());
+    }
+
+    // board modified, rebuilds all links of a board:
+    result["board_modified"] = measure(iterations,
+      [&world]()
+      {
+        for(uint32_t i = 0; i < world->boards->length; i++)
+          world->boards->operator[](i)->forceModified();
+      });
+
+    for(const bool ctw : {false, true})
+    {
+      auto path = std::filesystem::path(dir) / world->uuid.value();
+      if(ctw)
+        path += World::dotCTW;
+
+      json& format = result[ctw ? "ctw" : "directory"];
+
+      // save, the first iteration serializes all objects, following use the world's save cache:
+      format["save"] = measure(iterations,
+        [&world, &path]()
+        {
+          WorldSaver saver(*world, path);
+        });
+      format["size_bytes"] = diskSize(path);
+
+      // memory of a loaded world, measured while the first loaded world is alive:
+      json loadMemory;
+      format["load"] = measure(iterations,
+        [&path, &loadMemory, first=true]() mutable
+        {
+          const size_t memoryBefore = first ? memoryUsage() : 0;
+          WorldLoader loader(path);
+          if(std::exchange(first, false))
+            loadMemory = memory(memoryBefore, memoryUsage());
+        });
+      format["load"]["memory_bytes"] = std::move(loadMemory);
+
+      // all loading steps on the calling thread, for comparison with the concurrent load:
+      WorldLoader::parallel = false;
+      format["load_sequential"] = measure(iterations,
+        [&path]()
+        {
+          WorldLoader loader(path);
+        });
+      WorldLoader::parallel = true;
+
+      // CBOR encoded world and state files:
+      {
+        std::filesystem::remove_all(path);
+        json& cbor = format["cbor"];
+        cbor["save"] = measure(iterations,
+          [&world, &path]()
+          {
+            WorldSaver saver(*world, path, true);
+          });
+        cbor["size_bytes"] = diskSize(path);
+        cbor["load"] = measure(iterations,
+          [&path]()
+          {
+            WorldLoader loader(path);
+          });
+      }
+
+      std::filesystem::remove_all(path);
+      std::filesystem::remove(WorldJournal::filename(path));
+      if(ctw)
+        std::filesystem::remove(WorldStateCheckpoint::filename(path));
+    }
+
+    json& micro = result["micro"];
+    micro["event_loop_queue"] = Benchmark::eventLoopQueue();
+    micro["object_property_changed"] = Benchmark::objectPropertyChanged();
+    micro["message"] = Benchmark::message();
+    micro["tile_grid"] = Benchmark::tileGrid();
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if(output.empty())
+    std::cout << result.dump(2) << std::endl;
+  else
+  {
+    std::ofstream file(output);
+    if(!file.is_open())
+    {
+      std::cerr << "can't open " << output << std::endl;
+      return EXIT_FAILURE;
+    }
+    file << result.dump(2) << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+/**
+ * server/benchmark/message.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "benchmark.hpp"
+#include <chrono>
+#include <vector>
+#include <traintastic/network/message.hpp>
+
+namespace Benchmark {
+
+nlohmann::json message()
+{
+  using SteadyClock = std::chrono::steady_clock;
+  static constexpr size_t count = 1'000'000;
+  static const std::string value(32, 'x');
+
+  size_t bytes = 0;
+  std::vector<std::unique_ptr<Message>> messages;
+  messages.reserve(1000);
+
+  SteadyClock::duration encodeDuration{};
+  SteadyClock::duration decodeDuration{};
+  size_t check = 0;
+
+  for(size_t i = 0; i < count; i += messages.capacity())
+  {
+    auto start = SteadyClock::now();
+    for(size_t j = 0; j < messages.capacity(); j++)
+    {
+      auto& message = messages.emplace_back(Message::newEvent(Message::Command::ObjectPropertyChanged));
+      message->write(static_cast<uint32_t>(j));
+      message->write(std::string_view("speed"));
+      message->write(static_cast<uint8_t>(2));
+      message->write(static_cast<double>(i + j));
+      message->write(value);
+    }
+    encodeDuration += SteadyClock::now() - start;
+
+    start = SteadyClock::now();
+    for(const auto& message : messages)
+    {
+      check += message->read<uint32_t>();
+      check += message->read<std::string_view>().size();
+      check += message->read<uint8_t>();
+      check += static_cast<size_t>(message->read<double>());
+      check += message->read<std::string_view>().size();
+      bytes += message->size();
+    }
+    messages.clear(); // buffers are returned to the pool
+    decodeDuration += SteadyClock::now() - start;
+  }
+
+  using namespace std::chrono;
+  const auto measurement =
+    [bytes](SteadyClock::duration duration)
+    {
+      nlohmann::json r = nlohmann::json::object();
+      r["ns_per_message"] = duration_cast<nanoseconds>(duration).count() / count;
+      r["mb_per_second"] = static_cast<double>(bytes) / duration_cast<microseconds>(duration).count();
+      return r;
+    };
+
+  nlohmann::json result = nlohmann::json::object();
+  result["messages"] = count;
+  result["encode"] = measurement(encodeDuration);
+  result["decode"] = measurement(decodeDuration);
+  result["check"] = check; // keeps the decoding from being optimized away
+  return result;
+}
+
+}
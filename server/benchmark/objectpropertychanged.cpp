@@ -0,0 +1,82 @@
+/**
+ * server/benchmark/objectpropertychanged.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "benchmark.hpp"
+#include <chrono>
+#include <thread>
+#include "../src/core/eventloop.hpp"
+#include "../src/network/session.hpp"
+#include "../src/world/world.hpp"
+
+namespace Benchmark {
+
+nlohmann::json objectPropertyChanged()
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  using SteadyClock = std::chrono::steady_clock;
+  static constexpr size_t changes = 100'000;
+
+  auto world = World::create();
+
+  nlohmann::json result = nlohmann::json::object();
+  result["changes"] = changes;
+  nlohmann::json& results = result["sessions"] = nlohmann::json::object();
+
+  for(size_t sessions : {1, 2, 6, 16})
+  {
+    std::vector<std::unique_ptr<Message>> perSession;
+    std::vector<std::shared_ptr<const Message>> shared;
+    perSession.reserve(sessions);
+    shared.reserve(sessions);
+
+    SteadyClock::duration perSessionDuration{};
+    SteadyClock::duration sharedDuration{};
+
+    for(size_t i = 0; i < changes; i++)
+    {
+      world->scaleRatio.setValueInternal(static_cast<double>(i));
+
+      auto start = SteadyClock::now();
+      for(size_t session = 0; session < sessions; session++)
+        perSession.emplace_back(Session::newObjectPropertyChangedEvent(static_cast<uint32_t>(session + 1), world->scaleRatio));
+      perSessionDuration += SteadyClock::now() - start;
+
+      start = SteadyClock::now();
+      for(size_t session = 0; session < sessions; session++)
+        shared.emplace_back(Session::sharedObjectPropertyChangedEvent(world->scaleRatio));
+      sharedDuration += SteadyClock::now() - start;
+
+      perSession.clear();
+      shared.clear();
+    }
+
+    using std::chrono::nanoseconds;
+    nlohmann::json& r = results[std::to_string(sessions)];
+    r["per_session_ns_per_change"] = std::chrono::duration_cast<nanoseconds>(perSessionDuration).count() / changes;
+    r["shared_ns_per_change"] = std::chrono::duration_cast<nanoseconds>(sharedDuration).count() / changes;
+  }
+
+  return result;
+}
+
+}
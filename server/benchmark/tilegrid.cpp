@@ -0,0 +1,129 @@
+/**
+ * server/benchmark/tilegrid.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "benchmark.hpp"
+#include <chrono>
+#include <unordered_map>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/tilegrid.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+
+namespace Benchmark {
+
+nlohmann::json tileGrid()
+{
+  using SteadyClock = std::chrono::steady_clock;
+  using TileMap = std::unordered_map<TileLocation, std::shared_ptr<Tile>, TileLocationHash>;
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  auto world = World::create();
+  auto board = world->boards->create();
+  board->addTile(0, 0, TileRotate::Deg0, StraightRailTile::classId, false);
+  const auto tile = board->getTile({0, 0});
+
+  // viewport of 160 x 90 tiles:
+  const TileLocation min{-80, -45};
+  const TileLocation max{79, 44};
+
+  nlohmann::json result = nlohmann::json::object();
+
+  // a full board of Board::sizeMin to Board::sizeMax, with 1x1 tiles and with 1x8 tiles (blocks):
+  for(const uint8_t height : {1, 8})
+  {
+    TileMap map;
+    TileGrid grid;
+
+    auto start = SteadyClock::now();
+    for(int y = Board::sizeMin; y + height <= Board::sizeMax; y += height)
+      for(int x = Board::sizeMin; x < Board::sizeMax; x++)
+        for(int16_t yy = 0; yy < height; yy++)
+          map.emplace(TileLocation{static_cast<int16_t>(x), static_cast<int16_t>(y + yy)}, tile);
+    const auto mapInsert = SteadyClock::now() - start;
+
+    start = SteadyClock::now();
+    for(int y = Board::sizeMin; y + height <= Board::sizeMax; y += height)
+      for(int x = Board::sizeMin; x < Board::sizeMax; x++)
+        grid.insert(tile, {static_cast<int16_t>(x), static_cast<int16_t>(y)}, 1, height);
+    const auto gridInsert = SteadyClock::now() - start;
+
+    // map node: next pointer, value and cached hash:
+    const size_t mapMemory = map.size() * (sizeof(void*) + sizeof(TileMap::value_type) + sizeof(size_t)) + map.bucket_count() * sizeof(void*);
+
+    size_t mapCount = 0;
+    start = SteadyClock::now();
+    for(const auto& it : map)
+      if(it.second)
+        mapCount++;
+    const auto mapIterate = SteadyClock::now() - start;
+
+    size_t gridCount = 0;
+    start = SteadyClock::now();
+    grid.forEach(
+      [&gridCount](const std::shared_ptr<Tile>& /*tile*/)
+      {
+        gridCount++;
+      });
+    const auto gridIterate = SteadyClock::now() - start;
+
+    size_t mapViewportCount = 0;
+    start = SteadyClock::now();
+    for(int16_t y = min.y; y <= max.y; y++)
+      for(int16_t x = min.x; x <= max.x; x++)
+        if(map.find({x, y}) != map.end())
+          mapViewportCount++;
+    const auto mapViewport = SteadyClock::now() - start;
+
+    size_t gridViewportCount = 0;
+    start = SteadyClock::now();
+    grid.forEach(min, max,
+      [&gridViewportCount](const std::shared_ptr<Tile>& /*tile*/)
+      {
+        gridViewportCount++;
+      });
+    const auto gridViewport = SteadyClock::now() - start;
+
+    nlohmann::json& r = result["1x" + std::to_string(height)];
+    r["map"] = {
+      {"tiles", mapCount},
+      {"insert_us", duration_cast<microseconds>(mapInsert).count()},
+      {"memory_bytes", mapMemory},
+      {"iterate_us", duration_cast<microseconds>(mapIterate).count()},
+      {"viewport_us", duration_cast<microseconds>(mapViewport).count()},
+      {"viewport_tiles", mapViewportCount}};
+    r["grid"] = {
+      {"tiles", gridCount},
+      {"insert_us", duration_cast<microseconds>(gridInsert).count()},
+      {"memory_bytes", grid.memoryUsage()},
+      {"iterate_us", duration_cast<microseconds>(gridIterate).count()},
+      {"viewport_us", duration_cast<microseconds>(gridViewport).count()},
+      {"viewport_tiles", gridViewportCount}};
+  }
+
+  return result;
+}
+
+}
@@ -0,0 +1,114 @@
+/**
+ * server/benchmark/worldgenerator.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "worldgenerator.hpp"
+#include <algorithm>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+#include "../src/hardware/decoder/decoder.hpp"
+#include "../src/hardware/decoder/list/decoderlist.hpp"
+#include "../src/hardware/input/input.hpp"
+#include "../src/hardware/input/list/inputlist.hpp"
+#include "../src/hardware/output/output.hpp"
+#include "../src/hardware/output/list/outputlist.hpp"
+#include "../src/lua/script.hpp"
+#include "../src/lua/scriptlist.hpp"
+#include "../src/train/train.hpp"
+#include "../src/train/trainlist.hpp"
+#include "../src/train/trainvehiclelist.hpp"
+#include "../src/vehicle/rail/locomotive.hpp"
+#include "../src/vehicle/rail/railvehiclelist.hpp"
+
+nlohmann::json WorldGenerator::Config::toJSON() const
+{
+  nlohmann::json config = nlohmann::json::object();
+  config["boards"] = boards;
+  config["tiles"] = tiles;
+  config["blocks"] = blocks;
+  config["decoders"] = decoders;
+  config["inputs"] = inputs;
+  config["outputs"] = outputs;
+  config["trains"] = trains;
+  config["scripts"] = scripts;
+  return config;
+}
+
+std::shared_ptr<World> WorldGenerator::generate(const Config& config)
+{
+  auto world = World::create();
+
+  // every board has vertical tracks: a block followed by straight rails, with an empty column in between:
+  const uint32_t tracks = std::max<uint32_t>(config.blocks, 1);
+  const auto trackLength = static_cast<int16_t>(std::clamp<uint32_t>(config.tiles / tracks, 1, Board::sizeMax));
+
+  for(uint32_t i = 0; i < config.boards; i++)
+  {
+    auto board = world->boards->create();
+    uint32_t tiles = 0;
+    for(uint32_t track = 0; track < tracks && tiles < config.tiles; track++)
+    {
+      const auto x = static_cast<int16_t>(track * 2);
+      for(int16_t y = 0; y < trackLength && tiles < config.tiles; y++, tiles++)
+      {
+        const bool block = y == 0 && track < config.blocks;
+        board->addTile(x, y, TileRotate::Deg0, block ? BlockRailTile::classId : StraightRailTile::classId, false);
+      }
+    }
+  }
+
+  for(uint32_t i = 0; i < config.decoders; i++)
+    world->decoders->create()->address.setValueInternal(static_cast<uint16_t>(1 + i % 9999));
+
+  for(uint32_t i = 0; i < config.inputs; i++)
+    world->inputs->create()->address.setValueInternal(1 + i);
+
+  for(uint32_t i = 0; i < config.outputs; i++)
+    world->outputs->create()->address.setValueInternal(1 + i);
+
+  for(uint32_t i = 0; i < config.trains; i++)
+  {
+    auto train = world->trains->create();
+    train->vehicles->add(world->railVehicles->create(Locomotive::classId));
+  }
+
+  for(uint32_t i = 0; i < config.scripts; i++)
+  {
+    std::string code;
+    for(int j = 0; j < 25; j++)
+    {
+      const auto n = std::to_string(j);
+      code.append("function on_event_").append(n).append("(value)\n")
+        .append("  if value > ").append(n).append(" then\n")
+        .append("    log.info('value', value)\n")
+        .append("  end\n")
+        .append("end\n\n");
+    }
+    world->luaScripts->create()->code.setValueInternal(code);
+  }
+
+  return world;
+}
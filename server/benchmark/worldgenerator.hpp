@@ -0,0 +1,53 @@
+/**
+ * server/benchmark/worldgenerator.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BENCHMARK_WORLDGENERATOR_HPP
+#define TRAINTASTIC_SERVER_BENCHMARK_WORLDGENERATOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include "../src/utils/json.hpp"
+
+class World;
+
+//! \brief Generates synthetic worlds for benchmarking
+class WorldGenerator
+{
+  public:
+    struct Config
+    {
+      uint32_t boards = 10;
+      uint32_t tiles = 1000; //!< rail tiles per board, including blocks
+      uint32_t blocks = 20; //!< blocks per board
+      uint32_t decoders = 100;
+      uint32_t inputs = 500;
+      uint32_t outputs = 500;
+      uint32_t trains = 50; //!< each train gets a locomotive
+      uint32_t scripts = 10;
+
+      nlohmann::json toJSON() const;
+    };
+
+    static std::shared_ptr<World> generate(const Config& config);
+};
+
+#endif
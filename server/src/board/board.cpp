@@ -24,11 +24,15 @@
 #include "boardlist.hpp"
 #include "boardlisttablemodel.hpp"
 #include "map/link.hpp"
+#include "map/node.hpp"
 #include "tile/tiles.hpp"
+#include "tile/rail/linkrailtile.hpp"
 #include "../core/method.tpp"
 #include "../core/objectproperty.tpp"
 #include "../world/world.hpp"
 #include "../world/worldloader.hpp"
+#include "../world/worldsaver.hpp"
+#include "../world/worldjournal.hpp"
 #include "../core/attributes.hpp"
 #include "../utils/displayname.hpp"
 #include <cassert>
@@ -47,13 +51,13 @@ Board::Board(World& world, std::string_view _id) :
     {
       const TileLocation l{x, y};
 
-      if(auto it = m_tiles.find(l); it != m_tiles.end())
+      if(auto existing = m_tiles.get(l))
       {
         if(!replace)
         {
-          const TileRotate tileRotate = it->second->rotate;
+          const TileRotate tileRotate = existing->rotate;
 
-          if(it->second->tileId() == TileId::RailStraight && tileClassId == StraightRailTile::classId) // merge to bridge
+          if(existing->tileId() == TileId::RailStraight && tileClassId == StraightRailTile::classId) // merge to bridge
           {
             if((tileRotate == rotate + TileRotate::Deg90 || tileRotate == rotate - TileRotate::Deg90) && deleteTile(x, y))
             {
@@ -73,7 +77,7 @@ Board::Board(World& world, std::string_view _id) :
             else
               return false;
           }
-          else if(it->second->tileId() == TileId::RailStraight && // replace straight by a straight with something extra
+          else if(existing->tileId() == TileId::RailStraight && // replace straight by a straight with something extra
                   Tiles::canUpgradeStraightRail(tileClassId) &&
                   (tileRotate == rotate || (tileRotate + TileRotate::Deg180) == rotate) &&
                   deleteTile(x, y))
@@ -103,13 +107,12 @@ Board::Board(World& world, std::string_view _id) :
         tile->destroy();
         return false;
       }
-      for(int16_t xx = tile->location().x; xx < x2; xx++)
-        for(int16_t yy = tile->location().y; yy < y2; yy++)
-          m_tiles[TileLocation{xx, yy}] = tile;
+      m_tiles.insert(tile, tile->location(), tile->width, tile->height);
 
       tileDataChanged(*this, tile->location(), tile->data());
+      WorldJournal::changed(*this);
       updateSize();
-      m_modified = true;
+      tileModified(tile->location(), tile->width, tile->height);
       return true;
     }},
   moveTile{*this, "move_tile",
@@ -171,17 +174,11 @@ Board::Board(World& world, std::string_view _id) :
       tile->rotate.setValueInternal(rotate);
 
       // place tile at <To>
-      for(int16_t x = xTo; x < xTo2; x++)
-        for(int16_t y = yTo; y < yTo2; y++)
-        {
-          const TileLocation l{x, y};
-          assert(m_tiles.find(l) == m_tiles.end());
-          m_tiles[l] = tile;
-        }
+      m_tiles.insert(tile, tile->location(), width, height);
       tileDataChanged(*this, tile->location(), tile->data());
 
       updateSize();
-      m_modified = true;
+      tileModified(tile->location(), width, height);
       return true;
     }},
   resizeTile{*this, "resize_tile",
@@ -215,22 +212,11 @@ Board::Board(World& world, std::string_view _id) :
         return false;
 
       // update m_tiles
-      {
-        const int16_t x2 = x + std::max(width, oldWidth);
-        const int16_t y2 = y + std::max(height, oldHeight);
-        const int16_t xNew = x + width;
-        const int16_t yNew = y + height;
-
-        for(int16_t xx = x; xx < x2; xx++)
-          for(int16_t yy = y; yy < y2; yy++)
-            if(xx < xNew && yy < yNew)
-              m_tiles[{xx, yy}] = tile;
-            else
-              m_tiles.erase({xx, yy});
-      }
+      m_tiles.erase(tile->location(), oldWidth, oldHeight);
+      m_tiles.insert(tile, tile->location(), width, height);
 
       tileDataChanged(*this, tile->location(), tile->data());
-      m_modified = true;
+      tileModified(tile->location(), std::max(width, oldWidth), std::max(height, oldHeight));
       return true;
     }},
   deleteTile{*this, "delete_tile",
@@ -242,7 +228,6 @@ Board::Board(World& world, std::string_view _id) :
         removeTile(x, y);
         tile->destroy();
         updateSize();
-        m_modified = true;
       }
       return true;
     }},
@@ -292,9 +277,11 @@ void Board::addToWorld()
 
 void Board::destroying()
 {
-  for(auto& it : m_tiles)
-    if(it.first == it.second->location()) // only on origin
-      it.second->destroy();
+  m_tiles.forEach(
+    [](const std::shared_ptr<Tile>& tile)
+    {
+      tile->destroy();
+    });
   m_tiles.clear();
   m_world.boards->removeObject(shared_ptr<Board>());
   IdObject::destroying();
@@ -305,27 +292,11 @@ void Board::load(WorldLoader& loader, const nlohmann::json& data)
   IdObject::load(loader, data);
 
   nlohmann::json objects = data.value("tiles", nlohmann::json::array());
-  std::vector<ObjectPtr> items;
-  m_tiles.reserve(objects.size());
   for(auto& [_, tileId] : objects.items())
   {
     static_cast<void>(_); // silence unused warning
     if(auto tile = std::dynamic_pointer_cast<Tile>(loader.getObject(tileId.get<std::string_view>())))
-    {
-      if(tile->width > 1 || tile->height > 1)
-      {
-        const int16_t x2 = tile->location().x + tile->width;
-        const int16_t y2 = tile->location().y + tile->height;
-        for(int16_t x = tile->location().x; x < x2; x++)
-          for(int16_t y = tile->location().y; y < y2; y++)
-            m_tiles.emplace(TileLocation{x, y}, tile);
-      }
-      else
-      {
-        const TileLocation l = tile->location();
-        m_tiles.emplace(l, std::move(tile));
-      }
-    }
+      m_tiles.insert(tile, tile->location(), tile->width, tile->height);
   }
 }
 
@@ -333,10 +304,15 @@ void Board::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state)
 {
   IdObject::save(saver, data, state);
 
+  if(saver.isStateOnly()) // tiles are saved as separate objects
+    return;
+
   nlohmann::json tiles = nlohmann::json::array();
-  for(const auto& it : m_tiles)
-    if(it.first == it.second->location())
-      tiles.push_back(it.second->id);
+  m_tiles.forEach(
+    [&tiles](const std::shared_ptr<Tile>& tile)
+    {
+      tiles.push_back(tile->id);
+    });
   std::sort(tiles.begin(), tiles.end(),
     [](const nlohmann::json& a, const nlohmann::json& b)
     {
@@ -364,79 +340,205 @@ void Board::loaded()
 {
   IdObject::loaded();
 
-  m_modified = true;
+  m_modifiedAll = true;
   modified();
 }
 
+void Board::tileModified(TileLocation l, uint8_t width, uint8_t height)
+{
+  for(uint8_t x = 0; x < width; x++)
+    for(uint8_t y = 0; y < height; y++)
+      m_modifiedLocations.emplace(l.adjusted(x, y));
+}
+
+void Board::tileModified(const Tile& tile)
+{
+  tileModified(tile.location(), tile.width, tile.height);
+}
+
 void Board::modified()
 {
-  if(!m_modified)
+  if(!isModified())
     return;
 
-  auto updateLink =
-    [this](const std::shared_ptr<Tile>& startTile, const Connector& startConnector)
-    {
-      assert(startTile->node());
+  if(m_modifiedAll)
+  {
+    // rebuild all links:
+    m_tiles.forEach(
+      [this](const std::shared_ptr<Tile>& tile)
+      {
+        if(tile->node())
+          updateLinks(tile);
+      });
 
-      std::vector<std::shared_ptr<Tile>> tiles;
-      std::vector<Connector> connectors;
-      connectors.reserve(2);
+    // notify board changed:
+    m_tiles.forEach(
+      [](const std::shared_ptr<Tile>& tile)
+      {
+        tile->boardModified();
+      });
+  }
+  else
+  {
+    // find the nodes with a link that passes or ends at a modified location,
+    // follow the track from the modified locations and their neighbours up to the first node:
+    std::unordered_set<const Tile*> visited;
+    std::vector<std::shared_ptr<Tile>> todo;
+    std::vector<std::shared_ptr<Tile>> nodes;
+    std::vector<Connector> connectors;
+
+    for(auto l : m_modifiedLocations)
+      for(int16_t dx = -1; dx <= 1; dx++)
+        for(int16_t dy = -1; dy <= 1; dy++)
+          if(auto tile = getTile(l.adjusted(dx, dy)); tile && visited.emplace(tile.get()).second)
+            todo.emplace_back(std::move(tile));
 
-      Connector connector{startConnector.opposite()};
-      while(auto nextTile = getTile(connector.location))
+    while(!todo.empty())
+    {
+      auto tile = std::move(todo.back());
+      todo.pop_back();
+
+      if(tile->node())
       {
-        if(nextTile->node())
-        {
-          auto link = std::make_shared<Link>(std::move(tiles));
-          link->connect(*startTile->node(), startConnector, *nextTile->node(), connector);
-          return;
-        }
-        tiles.emplace_back(nextTile);
-        connectors.clear();
-        nextTile->getConnectors(connectors);
-        if(connectors.size() == 2)
-        {
-          assert(connectors[0] == connector || connectors[1] == connector);
-          connector = connectors[connectors[0] == connector ? 1 : 0].opposite();
-        }
-        else
-        {
-          assert(connectors.size() == 1);
-          assert(connectors[0] == connector);
-          break;
-        }
+        nodes.emplace_back(std::move(tile));
+        continue;
       }
 
-      startTile->node()->get().disconnect(startConnector);
-    };
+      connectors.clear();
+      tile->getConnectors(connectors);
+      for(const auto& connector : connectors)
+        if(auto next = getTile(connector.opposite().location); next && visited.emplace(next.get()).second)
+          todo.emplace_back(std::move(next));
+    }
+
+    // rebuild links of the affected nodes:
+    for(const auto& tile : nodes)
+      updateLinks(tile);
+
+    // notify board changed, only the tiles in the affected region:
+    notifyNodesModified(nodes);
+  }
+
+  m_modifiedAll = false;
+  m_modifiedLocations.clear();
+}
+
+void Board::updateLinks(const std::shared_ptr<Tile>& tile)
+{
+  assert(tile->node());
+
+  std::vector<Connector> connectors;
+  tile->getConnectors(connectors);
+  assert(!connectors.empty());
+
+  std::vector<Connector> nextConnectors;
+  nextConnectors.reserve(2);
 
-  // check/rebuild links:
+  for(const auto& startConnector : connectors)
   {
-    std::vector<Connector> connectors;
+    std::vector<std::shared_ptr<Tile>> tiles;
+    bool connected = false;
 
-    for(auto& [l, tile] : m_tiles)
+    Connector connector{startConnector.opposite()};
+    while(auto nextTile = getTile(connector.location))
     {
-      if(auto node = tile->node(); node && l == tile->location())
+      if(nextTile->node())
       {
-        connectors.clear();
+        auto link = std::make_shared<Link>(std::move(tiles));
+        link->connect(*tile->node(), startConnector, *nextTile->node(), connector);
+        connected = true;
+        break;
+      }
+      tiles.emplace_back(nextTile);
+      nextConnectors.clear();
+      nextTile->getConnectors(nextConnectors);
+      if(nextConnectors.size() == 2)
+      {
+        assert(nextConnectors[0] == connector || nextConnectors[1] == connector);
+        connector = nextConnectors[nextConnectors[0] == connector ? 1 : 0].opposite();
+      }
+      else
+      {
+        assert(nextConnectors.size() == 1);
+        assert(nextConnectors[0] == connector);
+        break;
+      }
+    }
 
-        tile->getConnectors(connectors);
+    if(!connected)
+      tile->node()->get().disconnect(startConnector);
+  }
+}
+
+void Board::notifyNodesModified(const std::vector<std::shared_ptr<Tile>>& nodes)
+{
+  // block paths end at the next block, signal paths look ahead up to two blocks:
+  constexpr size_t signalBlockDepth = 2;
+
+  std::unordered_set<const Node*> visited;
+  std::vector<Node*> todo;
+  std::vector<Node*> behindBlock;
+  std::vector<Tile*> blocks;
+  std::vector<Tile*> tiles;
+
+  for(const auto& tile : nodes)
+    behindBlock.emplace_back(&tile->node()->get());
+
+  for(size_t depth = 0; depth <= signalBlockDepth && !behindBlock.empty(); depth++)
+  {
+    // a node can be reached behind a block and directly, only visit it at the lowest depth:
+    for(auto* node : behindBlock)
+      if(visited.emplace(node).second)
+        todo.emplace_back(node);
+    behindBlock.clear();
+
+    while(!todo.empty())
+    {
+      Node& node = *todo.back();
+      todo.pop_back();
+
+      Tile& tile = node.tile();
+      const bool isBlock = tile.tileId() == TileId::RailBlock;
+
+      if(depth == 0)
+        (isBlock ? blocks : tiles).emplace_back(&tile);
+      else if(isRailSignal(tile.tileId()))
+        tiles.emplace_back(&tile);
 
-        assert(!connectors.empty());
-        for(const auto connector : connectors)
+      auto visit =
+        [&visited, &todo, &behindBlock, isBlock](Node& next)
         {
-          updateLink(tile, connector);
-        }
-      }
+          if(isBlock)
+            behindBlock.emplace_back(&next);
+          else if(visited.emplace(&next).second)
+            todo.emplace_back(&next);
+        };
+
+      for(const auto& link : node.links())
+        if(link)
+          visit(link->getNext(node));
+
+      if(tile.tileId() == TileId::RailLink) // continue on the linked board
+        if(const auto& linked = static_cast<LinkRailTile&>(tile).link.value())
+          visit(linked->node()->get());
     }
   }
 
-  // notify board changed:
-  for(auto& [l, tile] : m_tiles)
-    if(l == tile->location()) // check origin to notify each tile once
-      tile->boardModified();
+  // blocks first, signal paths are based on the block paths:
+  for(auto* block : blocks)
+    block->boardModified();
+  for(auto* tile : tiles)
+    tile->boardModified();
+}
+
+BlockRoutes::Route Board::findRoute(const BlockRailTile& from, const BlockRailTile& to)
+{
+  return m_world.blockRoutes().find(from, to);
+}
 
-  m_modified = false;
+BlockRoutes::Route Board::findFreeRoute(const BlockRailTile& from, const BlockRailTile& to)
+{
+  return m_world.blockRoutes().findFree(from, to);
 }
 
 void Board::removeTile(const int16_t x, const int16_t y)
@@ -445,36 +547,20 @@ void Board::removeTile(const int16_t x, const int16_t y)
   if(!tile)
     return;
   const auto l = tile->location();
-  const int16_t x2 = l.x + tile->width;
-  const int16_t y2 = l.y + tile->height;
-  for(int16_t xx = l.x; xx < x2; xx++)
-    for(int16_t yy = l.y; yy < y2; yy++)
-      m_tiles.erase(TileLocation{xx, yy});
+  tileModified(l, tile->width, tile->height);
+  m_tiles.erase(l, tile->width, tile->height);
   tileDataChanged(*this, l, TileData());
+  WorldJournal::changed(*this);
 }
 
 void Board::updateSize(bool allowShrink)
 {
-  if(!m_tiles.empty())
+  if(TileLocation min, max; m_tiles.bounds(min, max))
   {
-    auto it = m_tiles.cbegin();
-    int16_t xMin = it->first.x;
-    int16_t xMax = it->first.x;
-    int16_t yMin = it->first.y;
-    int16_t yMax = it->first.y;
-
-    while(++it != m_tiles.cend())
-    {
-      if(it->first.x < xMin)
-        xMin = it->first.x;
-      else if(it->first.x > xMax)
-        xMax = it->first.x;
-
-      if(it->first.y < yMin)
-        yMin = it->first.y;
-      else if(it->first.y > yMax)
-        yMax = it->first.y;
-    }
+    int16_t xMin = min.x;
+    int16_t xMax = max.x;
+    int16_t yMin = min.y;
+    int16_t yMax = max.y;
 
     xMin = std::clamp(xMin, sizeMin, sizeMax);
     yMin = std::clamp(yMin, sizeMin, sizeMax);
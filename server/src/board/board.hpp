@@ -24,30 +24,43 @@
 #define TRAINTASTIC_SERVER_BOARD_BOARD_HPP
 
 #include "../core/idobject.hpp"
-#include <unordered_map>
+#include <unordered_set>
 #include "../core/method.hpp"
+#include "tilegrid.hpp"
+#include "map/blockroutes.hpp"
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/enum/tilerotate.hpp>
 
 class Tile;
 struct TileData;
+class BlockRailTile;
 
 class Board : public IdObject
 {
   friend class BoardList;
 
-  public:
-    using TileMap = std::unordered_map<TileLocation, std::shared_ptr<Tile>, TileLocationHash>;
-
   private:
-    bool m_modified = false;
+    using TileLocationSet = std::unordered_set<TileLocation, TileLocationHash>;
+
+    bool m_modifiedAll = false; //!< Rebuild all links and notify all tiles
+    TileLocationSet m_modifiedLocations; //!< Locations of added, moved, resized and deleted tiles
+
+    bool isModified() const
+    {
+      return m_modifiedAll || !m_modifiedLocations.empty();
+    }
 
+    void tileModified(TileLocation l, uint8_t width, uint8_t height);
     void modified();
+    void updateLinks(const std::shared_ptr<Tile>& tile);
+
+    //! \brief Notify the tiles whose block or signal paths might pass one of the nodes
+    static void notifyNodesModified(const std::vector<std::shared_ptr<Tile>>& nodes);
     void removeTile(int16_t x, int16_t y);
     void updateSize(bool allowShrink = false);
 
   protected:
-    TileMap m_tiles;
+    TileGrid m_tiles;
 
     void addToWorld() final;
     void destroying() final;
@@ -78,28 +91,40 @@ class Board : public IdObject
 
     Board(World& world, std::string_view _id);
 
-    const TileMap& tileMap() const { return m_tiles; }
+#ifdef TRAINTASTIC_TEST
+    //! \brief Rebuild all links, for benchmarking
+    void forceModified()
+    {
+      m_modifiedAll = true;
+      modified();
+    }
+#endif
+
+    const TileGrid& tiles() const { return m_tiles; }
+
+    //! \brief Mark a tile as modified, its links and the paths passing it are updated when editing ends
+    void tileModified(const Tile& tile);
+
+    //! \brief Find the shortest route from block \a from to block \a to
+    //! Routes can continue on other boards, see \ref BlockRoutes.
+    BlockRoutes::Route findRoute(const BlockRailTile& from, const BlockRailTile& to);
+
+    //! \brief Find the shortest route from block \a from to block \a to that can be reserved now
+    BlockRoutes::Route findFreeRoute(const BlockRailTile& from, const BlockRailTile& to);
 
     bool isTile(TileLocation l)
     {
-      auto it = m_tiles.find(l);
-      return it != m_tiles.end();
+      return m_tiles.contains(l);
     }
 
     std::shared_ptr<const Tile> getTile(TileLocation l) const
     {
-      if(auto it = m_tiles.find(l); it != m_tiles.end())
-        return it->second;
-
-      return {};
+      return m_tiles.get(l);
     }
 
     std::shared_ptr<Tile> getTile(TileLocation l)
     {
-      if(auto it = m_tiles.find(l); it != m_tiles.end())
-        return it->second;
-
-      return {};
+      return m_tiles.get(l);
     }
 };
 
@@ -30,10 +30,13 @@
 #include "../tile/rail/linkrailtile.hpp"
 #include "../tile/rail/signal/signalrailtile.hpp"
 #include "../map/abstractsignalpath.hpp"
+#include "../map/signalevaluator.hpp"
+#include "../../world/world.hpp"
 #include "../../train/train.hpp" // FIXME: required due to forward declaration
 
 AbstractSignalPath::AbstractSignalPath(SignalRailTile& signal)
   : m_signal{signal}
+  , m_signalEvaluator{signal.world().signalEvaluator().weak_from_this()}
 {
 }
 
@@ -66,9 +69,9 @@ AbstractSignalPath::AbstractSignalPath(SignalRailTile& signal, size_t blocksAhea
 
 AbstractSignalPath::~AbstractSignalPath()
 {
-  for(auto& connection : m_connections)
+  if(auto evaluator = m_signalEvaluator.lock())
   {
-    connection.disconnect();
+    evaluator->remove(*this);
   }
 }
 
@@ -79,6 +82,18 @@ void AbstractSignalPath::evaluate()
   setAspect(stop ? SignalAspect::Stop : determineAspect());
 }
 
+void AbstractSignalPath::scheduleEvaluate()
+{
+  if(auto evaluator = m_signalEvaluator.lock()) /*[[likely]]*/
+  {
+    evaluator->markDirty(*this);
+  }
+  else
+  {
+    evaluate();
+  }
+}
+
 bool AbstractSignalPath::requireReservation() const
 {
   return (m_signal.requireReservation == AutoYesNo::Yes || (m_signal.requireReservation == AutoYesNo::Auto && m_requireReservation));
@@ -152,6 +167,14 @@ std::shared_ptr<BlockRailTile> AbstractSignalPath::getBlock(size_t index) const
   return {};
 }
 
+void AbstractSignalPath::dependsOn(RailTile& tile)
+{
+  if(auto evaluator = m_signalEvaluator.lock()) /*[[likely]]*/
+  {
+    evaluator->add(*this, tile);
+  }
+}
+
 std::unique_ptr<const AbstractSignalPath::Item> AbstractSignalPath::findBlocks(const Node& node, const Link& link, size_t blocksAhead)
 {
   const auto& nextNode = link.getNext(node);
@@ -159,11 +182,7 @@ std::unique_ptr<const AbstractSignalPath::Item> AbstractSignalPath::findBlocks(c
 
   if(auto block = std::dynamic_pointer_cast<BlockRailTile>(tile))
   {
-    m_connections.emplace_back(block->stateChanged.connect(
-      [this](const BlockRailTile& /*tile*/, BlockState /*state*/)
-      {
-        evaluate();
-      }));
+    dependsOn(*block);
 
     const auto enterSide = (nextNode.getLink(0).get() == &link) ? BlockSide::A : BlockSide::B;
     std::unique_ptr<const Item> next;
@@ -176,11 +195,7 @@ std::unique_ptr<const AbstractSignalPath::Item> AbstractSignalPath::findBlocks(c
   {
     if(const auto& nextLink = otherLink(nextNode, link))
     {
-      m_connections.emplace_back(signal->aspectChanged.connect(
-        [this](const SignalRailTile& /*tile*/, SignalAspect /*aspect*/)
-        {
-          evaluate();
-        }));
+      dependsOn(*signal);
 
       return std::unique_ptr<const AbstractSignalPath::Item>{
         new SignalItem(
@@ -190,11 +205,7 @@ std::unique_ptr<const AbstractSignalPath::Item> AbstractSignalPath::findBlocks(c
   }
   else if(auto turnout = std::dynamic_pointer_cast<TurnoutRailTile>(tile))
   {
-    m_connections.emplace_back(turnout->positionChanged.connect(
-      [this](const TurnoutRailTile& /*tile*/, TurnoutPosition /*position*/)
-      {
-        evaluate();
-      }));
+    dependsOn(*turnout);
 
     std::map<TurnoutPosition, std::unique_ptr<const Item>> next;
     for (const auto& tpl : getTurnoutLinks(*turnout, link))
@@ -214,11 +225,7 @@ std::unique_ptr<const AbstractSignalPath::Item> AbstractSignalPath::findBlocks(c
       //  ( )
       //   |
       //  0 A
-      m_connections.emplace_back(direction->stateChanged.connect(
-        [this](const DirectionControlRailTile& /*tile*/, DirectionControlState /*state*/)
-        {
-          evaluate();
-        }));
+      dependsOn(*direction);
 
       return std::unique_ptr<const AbstractSignalPath::Item>{
         new DirectionControlItem(
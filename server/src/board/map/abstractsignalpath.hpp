@@ -26,7 +26,7 @@
 #include "path.hpp"
 #include "link.hpp"
 #include <map>
-#include <boost/signals2/connection.hpp>
+#include <vector>
 #include <traintastic/enum/blockstate.hpp>
 
 class BlockRailTile;
@@ -37,11 +37,18 @@ class DirectionControlRailTile;
 enum class DirectionControlState : uint8_t;
 class SignalRailTile;
 enum class SignalAspect : uint8_t;
+class RailTile;
+class SignalEvaluator;
 
 class AbstractSignalPath : public Path
 {
+  friend class SignalEvaluator;
+
   private:
     SignalRailTile& m_signal;
+    std::weak_ptr<SignalEvaluator> m_signalEvaluator;
+    std::vector<const RailTile*> m_dependencies; //!< tiles registered in \ref SignalEvaluator
+    bool m_dirty = false; //!< queued for evaluation by \ref SignalEvaluator
 
     AbstractSignalPath(const AbstractSignalPath&) = delete;
     AbstractSignalPath& operator =(const AbstractSignalPath&) = delete;
@@ -155,7 +162,8 @@ class AbstractSignalPath : public Path
   private:
     std::unique_ptr<const Item> m_root;
     bool m_requireReservation = false;
-    std::vector<boost::signals2::connection> m_connections;
+
+    void dependsOn(RailTile& tile);
 
     std::unique_ptr<const Item> findBlocks(const Node& node, const Link& link, size_t blocksAhead);
 
@@ -202,6 +210,9 @@ class AbstractSignalPath : public Path
     virtual ~AbstractSignalPath();
 
     void evaluate();
+
+    //! \brief Evaluate in the next batched pass of the \ref SignalEvaluator
+    void scheduleEvaluate();
 };
 
 #endif
@@ -21,10 +21,13 @@
  */
 
 #include "blockpath.hpp"
+#include <optional>
 #include <queue>
 #include <traintastic/enum/crossstate.hpp>
 #include "node.hpp"
 #include "link.hpp"
+#include "blockpathconflicts.hpp"
+#include "signalevaluator.hpp"
 #include "../tile/rail/blockrailtile.hpp"
 #include "../tile/rail/bridgerailtile.hpp"
 #include "../tile/rail/crossrailtile.hpp"
@@ -34,6 +37,7 @@
 #include "../tile/rail/linkrailtile.hpp"
 #include "../tile/rail/nxbuttonrailtile.hpp"
 #include "../../core/objectproperty.tpp"
+#include "../../world/world.hpp"
 #include "../../enum/bridgepath.hpp"
 
 template<class T1, typename T2>
@@ -296,9 +300,18 @@ BlockPath::BlockPath(BlockRailTile& block, BlockSide side)
   : m_fromBlock{block}
   , m_fromSide{side}
   , m_toSide{static_cast<BlockSide>(-1)}
+  , m_conflictIndex{BlockPathConflicts::noIndex}
 {
 }
 
+BlockPath::~BlockPath()
+{
+  if(auto conflicts = m_blockPathConflicts.lock())
+  {
+    conflicts->remove(*this);
+  }
+}
+
 bool BlockPath::operator ==(const BlockPath& other) const noexcept
 {
   return
@@ -347,6 +360,15 @@ bool BlockPath::isReady() const
   return true;
 }
 
+bool BlockPath::isFree() const
+{
+  if(auto conflicts = m_blockPathConflicts.lock()) /*[[likely]]*/
+  {
+    return conflicts->isFree(*this);
+  }
+  return true;
+}
+
 std::shared_ptr<NXButtonRailTile> BlockPath::nxButtonFrom() const
 {
   return m_nxButtonFrom.lock();
@@ -364,6 +386,18 @@ bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
     return false;
   }
 
+  // evaluate the signals once all tiles are reserved:
+  std::optional<SignalEvaluator::Defer> deferSignalEvaluation;
+  if(!dryRun)
+  {
+    deferSignalEvaluation.emplace(m_fromBlock.world().signalEvaluator());
+  }
+
+  if(dryRun && !isFree())
+  {
+    return false; // a conflicting path is reserved
+  }
+
   if(!m_fromBlock.reserve(shared_from_this(), train, m_fromSide, dryRun))
   {
     assert(dryRun);
@@ -487,6 +521,11 @@ bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
     {
       nxButton->reserve();
     }
+
+    if(auto conflicts = m_blockPathConflicts.lock())
+    {
+      conflicts->reserved(*this);
+    }
   }
 
   return true;
@@ -499,6 +538,13 @@ bool BlockPath::release(bool dryRun)
     return false;
   }
 
+  // evaluate the signals once all tiles are released:
+  std::optional<SignalEvaluator::Defer> deferSignalEvaluation;
+  if(!dryRun)
+  {
+    deferSignalEvaluation.emplace(m_fromBlock.world().signalEvaluator());
+  }
+
   if(!m_fromBlock.release(m_fromSide, dryRun))
   {
     assert(dryRun);
@@ -595,6 +641,11 @@ bool BlockPath::release(bool dryRun)
     {
       nxButton->release();
     }
+
+    if(auto conflicts = m_blockPathConflicts.lock())
+    {
+      conflicts->released(*this);
+    }
   }
 
   return true;
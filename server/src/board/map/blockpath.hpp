@@ -44,12 +44,15 @@ class NXButtonRailTile;
 class Node;
 class Link;
 class Train;
+class BlockPathConflicts;
 
 /**
  * \brief A path between two blocks
  */
 class BlockPath : public Path, public std::enable_shared_from_this<BlockPath>
 {
+  friend class BlockPathConflicts;
+
   private:
     BlockRailTile& m_fromBlock;
     const BlockSide m_fromSide;
@@ -63,17 +66,29 @@ class BlockPath : public Path, public std::enable_shared_from_this<BlockPath>
     std::vector<std::weak_ptr<SignalRailTile>> m_signals; //!< signals in path
     std::weak_ptr<NXButtonRailTile> m_nxButtonFrom;
     std::weak_ptr<NXButtonRailTile> m_nxButtonTo;
+    std::weak_ptr<BlockPathConflicts> m_blockPathConflicts;
+    size_t m_conflictIndex; //!< index in \ref BlockPathConflicts
+    std::vector<uint64_t> m_conflicts; //!< bitset of conflicting paths, index is conflict index
 
   public:
     static std::vector<std::shared_ptr<BlockPath>> find(BlockRailTile& block);
 
     BlockPath(BlockRailTile& block, BlockSide side);
+    ~BlockPath();
 
     bool operator ==(const BlockPath& other) const noexcept;
 
     //! \return \c true if all turnouts are in position and direction controls are allowed to pass.
     bool isReady() const;
 
+    //! \return \c true if no conflicting path is reserved.
+    bool isFree() const;
+
+    size_t turnoutCount() const
+    {
+      return m_turnouts.size();
+    }
+
     bool hasNXButtons() const
     {
       return !m_nxButtonFrom.expired() && !m_nxButtonTo.expired();
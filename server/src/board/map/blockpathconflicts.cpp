@@ -0,0 +1,189 @@
+/**
+ * server/src/board/map/blockpathconflicts.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "blockpathconflicts.hpp"
+#include <algorithm>
+#include <cassert>
+#include "blockpath.hpp"
+#include "../tile/rail/bridgerailtile.hpp"
+#include "../tile/rail/crossrailtile.hpp"
+#include "../tile/rail/directioncontrolrailtile.hpp"
+#include "../tile/rail/signal/signalrailtile.hpp"
+#include "../tile/rail/turnout/turnoutrailtile.hpp"
+#include "../../enum/bridgepath.hpp"
+
+namespace {
+
+constexpr uint8_t exclusive = 0xFF;
+constexpr size_t bitsPerWord = 64;
+
+template<class T, class F>
+void forEachTile(const std::vector<std::weak_ptr<T>>& tiles, F&& f)
+{
+  for(const auto& tileWeak : tiles)
+    if(auto tile = tileWeak.lock())
+      f(tile.get(), exclusive);
+}
+
+template<class T, typename T2, class F>
+void forEachTile(const std::vector<std::pair<std::weak_ptr<T>, T2>>& tiles, F&& f)
+{
+  for(const auto& item : tiles)
+    if(auto tile = item.first.lock())
+      f(tile.get(), exclusive);
+}
+
+}
+
+void BlockPathConflicts::set(Bitset& bitset, size_t index)
+{
+  const size_t word = index / bitsPerWord;
+  if(word >= bitset.size())
+    bitset.resize(word + 1, 0);
+  bitset[word] |= uint64_t(1) << (index % bitsPerWord);
+}
+
+void BlockPathConflicts::reset(Bitset& bitset, size_t index)
+{
+  if(const size_t word = index / bitsPerWord; word < bitset.size())
+    bitset[word] &= ~(uint64_t(1) << (index % bitsPerWord));
+}
+
+bool BlockPathConflicts::test(const Bitset& bitset, size_t index)
+{
+  const size_t word = index / bitsPerWord;
+  return word < bitset.size() && (bitset[word] & (uint64_t(1) << (index % bitsPerWord)));
+}
+
+bool BlockPathConflicts::intersects(const Bitset& a, const Bitset& b)
+{
+  const size_t size = std::min(a.size(), b.size());
+  for(size_t i = 0; i < size; i++)
+    if(a[i] & b[i])
+      return true;
+  return false;
+}
+
+void BlockPathConflicts::add(BlockPath& path)
+{
+  assert(path.m_conflictIndex == noIndex);
+
+  size_t index;
+  if(!m_freeIndices.empty())
+  {
+    index = m_freeIndices.back();
+    m_freeIndices.pop_back();
+  }
+  else
+  {
+    index = m_entries.size();
+    m_entries.emplace_back();
+  }
+
+  Entry& entry = m_entries[index];
+  entry.path = &path;
+  entry.tiles.clear();
+  path.m_blockPathConflicts = weak_from_this();
+  path.m_conflictIndex = index;
+  path.m_conflicts.clear();
+
+  auto use =
+    [this, &entry, &path, index](const RailTile* tile, uint8_t mask)
+    {
+      auto& usages = m_usages[tile];
+      for(const auto& usage : usages)
+      {
+        if(usage.index != index && (usage.mask & mask))
+        {
+          set(path.m_conflicts, usage.index);
+          set(m_entries[usage.index].path->m_conflicts, index);
+        }
+      }
+      usages.emplace_back(Usage{index, mask});
+      entry.tiles.emplace_back(tile);
+    };
+
+  forEachTile(path.m_tiles, use);
+  forEachTile(path.m_turnouts, use);
+  forEachTile(path.m_directionControls, use);
+  forEachTile(path.m_crossings, use);
+  forEachTile(path.m_signals, use);
+  for(const auto& [bridgeWeak, bridgePath] : path.m_bridges)
+    if(auto bridge = bridgeWeak.lock())
+      use(bridge.get(), static_cast<uint8_t>(1 << static_cast<uint8_t>(bridgePath)));
+}
+
+void BlockPathConflicts::remove(BlockPath& path)
+{
+  const size_t index = path.m_conflictIndex;
+  if(index == noIndex)
+    return;
+
+  assert(index < m_entries.size() && m_entries[index].path == &path);
+  Entry& entry = m_entries[index];
+
+  for(const auto* tile : entry.tiles)
+  {
+    if(auto it = m_usages.find(tile); it != m_usages.end())
+    {
+      auto& usages = it->second;
+      usages.erase(std::remove_if(usages.begin(), usages.end(), [index](const Usage& usage) { return usage.index == index; }), usages.end());
+      if(usages.empty())
+        m_usages.erase(it);
+    }
+  }
+
+  for(size_t i = 0; i < m_entries.size(); i++)
+    if(test(path.m_conflicts, i))
+      reset(m_entries[i].path->m_conflicts, index);
+
+  reset(m_reserved, index);
+  entry.path = nullptr;
+  entry.tiles.clear();
+  m_freeIndices.emplace_back(index);
+
+  path.m_blockPathConflicts.reset();
+  path.m_conflictIndex = noIndex;
+  path.m_conflicts.clear();
+}
+
+void BlockPathConflicts::reserved(const BlockPath& path)
+{
+  if(path.m_conflictIndex != noIndex)
+    set(m_reserved, path.m_conflictIndex);
+}
+
+void BlockPathConflicts::released(const BlockPath& path)
+{
+  if(path.m_conflictIndex != noIndex)
+    reset(m_reserved, path.m_conflictIndex);
+}
+
+bool BlockPathConflicts::isFree(const BlockPath& path) const
+{
+  return !intersects(path.m_conflicts, m_reserved);
+}
+
+bool BlockPathConflicts::conflicts(const BlockPath& a, const BlockPath& b) const
+{
+  return b.m_conflictIndex != noIndex && test(a.m_conflicts, b.m_conflictIndex);
+}
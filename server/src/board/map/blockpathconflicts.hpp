@@ -0,0 +1,86 @@
+/**
+ * server/src/board/map/blockpathconflicts.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BOARD_MAP_BLOCKPATHCONFLICTS_HPP
+#define TRAINTASTIC_SERVER_BOARD_MAP_BLOCKPATHCONFLICTS_HPP
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class RailTile;
+class BlockPath;
+
+/**
+ * \brief Conflict matrix of all block paths of a world
+ *
+ * Two block paths conflict if they share a tile, except for the blocks at their ends.
+ * Bridges are shared only if both paths use the same track of the bridge.
+ * Each registered block path has a bitset of conflicting paths, so checking if a path
+ * can be reserved is a bitset intersection with the reserved paths.
+ */
+class BlockPathConflicts : public std::enable_shared_from_this<BlockPathConflicts>
+{
+  public:
+    using Bitset = std::vector<uint64_t>;
+
+    static constexpr size_t noIndex = std::numeric_limits<size_t>::max();
+
+  private:
+    struct Usage
+    {
+      size_t index;
+      uint8_t mask;
+    };
+
+    struct Entry
+    {
+      BlockPath* path;
+      std::vector<const RailTile*> tiles;
+    };
+
+    std::vector<Entry> m_entries; //!< index is the conflict index of the path
+    std::vector<size_t> m_freeIndices;
+    std::unordered_map<const RailTile*, std::vector<Usage>> m_usages;
+    Bitset m_reserved;
+
+    static void set(Bitset& bitset, size_t index);
+    static void reset(Bitset& bitset, size_t index);
+    static bool test(const Bitset& bitset, size_t index);
+    static bool intersects(const Bitset& a, const Bitset& b);
+
+  public:
+    void add(BlockPath& path);
+    void remove(BlockPath& path);
+
+    void reserved(const BlockPath& path);
+    void released(const BlockPath& path);
+
+    //! \return \c true if no conflicting path is reserved.
+    bool isFree(const BlockPath& path) const;
+
+    bool conflicts(const BlockPath& a, const BlockPath& b) const;
+};
+
+#endif
@@ -0,0 +1,247 @@
+/**
+ * server/src/board/map/blockroutes.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "blockroutes.hpp"
+#include <algorithm>
+#include <cassert>
+#include <queue>
+#include "blockpath.hpp"
+#include "../tile/rail/blockrailtile.hpp"
+
+void BlockRoutes::setCosts(const Costs& value)
+{
+  m_costs = value;
+  m_trees.clear();
+}
+
+BlockRoutes::Route BlockRoutes::find(const BlockRailTile& from, const BlockRailTile& to)
+{
+  if(&from == &to)
+  {
+    return {};
+  }
+
+  auto it = m_trees.find(&from);
+  if(it == m_trees.end())
+  {
+    it = m_trees.emplace(&from, search(from, nullptr,
+      [](const BlockPath& /*path*/, const BlockRailTile& /*toBlock*/)
+      {
+        return true;
+      })).first;
+  }
+  return route(it->second, to);
+}
+
+BlockRoutes::Route BlockRoutes::findFree(const BlockRailTile& from, const BlockRailTile& to)
+{
+  auto isFree =
+    [](const BlockPath& path, const BlockRailTile& toBlock)
+    {
+      return toBlock.state == BlockState::Free && path.isFree();
+    };
+
+  // the shortest route is the best alternative if it is free:
+  auto shortest = find(from, to);
+  if(std::all_of(shortest.paths.begin(), shortest.paths.end(),
+      [&isFree](const auto& path)
+      {
+        const auto toBlock = path->toBlock();
+        return toBlock && isFree(*path, *toBlock);
+      }))
+  {
+    return shortest;
+  }
+
+  return route(search(from, &to, isFree), to);
+}
+
+void BlockRoutes::add(const BlockPath& path)
+{
+  const auto toBlock = path.toBlock();
+  if(!toBlock)
+  {
+    return;
+  }
+
+  const Node from{&path.fromBlock(), path.fromSide()};
+  const Node to{toBlock.get(), ~path.toSide()};
+  const double pathCost = cost(path);
+
+  // discard the trees that get a shorter route by the new path:
+  for(auto it = m_trees.begin(); it != m_trees.end();)
+  {
+    const auto& nodes = it->second.nodes;
+    const auto fromIt = nodes.find(from);
+    const auto toIt = nodes.find(to);
+    if(fromIt != nodes.end() && (toIt == nodes.end() || fromIt->second.cost + pathCost < toIt->second.cost))
+    {
+      it = m_trees.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void BlockRoutes::remove(const BlockPath& path)
+{
+  for(auto it = m_trees.begin(); it != m_trees.end();)
+  {
+    if(it->second.paths.count(&path) != 0)
+    {
+      it = m_trees.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void BlockRoutes::remove(const BlockRailTile& block)
+{
+  for(auto it = m_trees.begin(); it != m_trees.end();)
+  {
+    const auto& nodes = it->second.nodes;
+    if(it->first == &block || nodes.count(Node{&block, BlockSide::A}) != 0 || nodes.count(Node{&block, BlockSide::B}) != 0)
+    {
+      it = m_trees.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+double BlockRoutes::cost(const BlockPath& path) const
+{
+  return m_costs.path + m_costs.turnout * static_cast<double>(path.turnoutCount());
+}
+
+template<class Filter>
+BlockRoutes::Tree BlockRoutes::search(const BlockRailTile& from, const BlockRailTile* to, Filter filter) const
+{
+  using Item = std::pair<double, Node>;
+  auto greater =
+    [](const Item& a, const Item& b)
+    {
+      return a.first > b.first;
+    };
+  std::priority_queue<Item, std::vector<Item>, decltype(greater)> todo(greater);
+  std::unordered_set<Node, NodeHash> done;
+  Tree tree;
+
+  // a train can leave the start block at both sides:
+  for(const auto side : {BlockSide::A, BlockSide::B})
+  {
+    const Node start{&from, side};
+    tree.nodes.emplace(start, TreeNode{0.0, start, nullptr});
+    todo.emplace(0.0, start);
+  }
+
+  while(!todo.empty())
+  {
+    const double nodeCost = todo.top().first;
+    const Node node = todo.top().second;
+    todo.pop();
+
+    if(!done.emplace(node).second)
+    {
+      continue; // already visited with lower cost
+    }
+
+    if(node.block == to)
+    {
+      break;
+    }
+
+    auto relax =
+      [&tree, &todo, &node](const Node& next, double nextCost, BlockPath* path)
+      {
+        auto it = tree.nodes.find(next);
+        if(it == tree.nodes.end() || nextCost < it->second.cost)
+        {
+          tree.nodes[next] = TreeNode{nextCost, node, path};
+          todo.emplace(nextCost, next);
+        }
+      };
+
+    for(const auto& path : node.block->paths())
+    {
+      if(path->fromSide() != node.side)
+      {
+        continue;
+      }
+
+      const auto toBlock = path->toBlock();
+      if(toBlock && filter(*path, *toBlock))
+      {
+        relax(Node{toBlock.get(), ~path->toSide()}, nodeCost + cost(*path), path.get());
+      }
+    }
+
+    if(m_costs.reverse >= 0 && node.block != &from)
+    {
+      relax(Node{node.block, ~node.side}, nodeCost + m_costs.reverse, nullptr);
+    }
+  }
+
+  for(const auto& it : tree.nodes)
+  {
+    if(it.second.path)
+    {
+      tree.paths.emplace(it.second.path);
+    }
+  }
+
+  return tree;
+}
+
+BlockRoutes::Route BlockRoutes::route(const Tree& tree, const BlockRailTile& to)
+{
+  const auto itA = tree.nodes.find(Node{&to, BlockSide::A});
+  const auto itB = tree.nodes.find(Node{&to, BlockSide::B});
+  if(itA == tree.nodes.end() && itB == tree.nodes.end())
+  {
+    return {}; // not reachable
+  }
+
+  auto it = (itB == tree.nodes.end() || (itA != tree.nodes.end() && itA->second.cost <= itB->second.cost)) ? itA : itB;
+
+  Route route;
+  route.cost = it->second.cost;
+  while(!(it->second.previous == it->first)) // start node refers to itself
+  {
+    if(it->second.path)
+    {
+      route.paths.emplace_back(it->second.path->shared_from_this());
+    }
+    it = tree.nodes.find(it->second.previous);
+    assert(it != tree.nodes.end());
+  }
+  std::reverse(route.paths.begin(), route.paths.end());
+
+  return route;
+}
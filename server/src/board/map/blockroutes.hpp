@@ -0,0 +1,130 @@
+/**
+ * server/src/board/map/blockroutes.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BOARD_MAP_BLOCKROUTES_HPP
+#define TRAINTASTIC_SERVER_BOARD_MAP_BLOCKROUTES_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../../enum/blockside.hpp"
+
+class BlockRailTile;
+class BlockPath;
+
+/**
+ * \brief Block level route planner
+ *
+ * The routing graph is formed by the block paths, see \ref BlockRailTile::paths().
+ * A node is a block and the side a train leaves it, a block path is an edge to the
+ * opposite side of the block it enters.
+ *
+ * Shortest routes are found using Dijkstra's algorithm, for each start block the
+ * shortest path tree is cached. When block paths are added or removed only the
+ * trees that are affected are discarded.
+ */
+class BlockRoutes
+{
+  public:
+    struct Costs
+    {
+      double path = 1.0; //!< Cost of each block path
+      double turnout = 0.0; //!< Additional cost for each turnout in a block path
+      double reverse = -1.0; //!< Cost of reversing in a block, negative if not allowed
+    };
+
+    struct Route
+    {
+      std::vector<std::shared_ptr<BlockPath>> paths;
+      double cost = 0.0;
+
+      bool empty() const
+      {
+        return paths.empty();
+      }
+    };
+
+  private:
+    struct Node
+    {
+      const BlockRailTile* block;
+      BlockSide side; //!< side the train leaves the block
+
+      bool operator ==(const Node& other) const
+      {
+        return block == other.block && side == other.side;
+      }
+    };
+
+    struct NodeHash
+    {
+      size_t operator()(const Node& node) const
+      {
+        return std::hash<const void*>()(node.block) ^ static_cast<size_t>(node.side);
+      }
+    };
+
+    struct TreeNode
+    {
+      double cost;
+      Node previous;
+      BlockPath* path; //!< path from previous node, \c nullptr if reversed or start node
+    };
+
+    struct Tree
+    {
+      std::unordered_map<Node, TreeNode, NodeHash> nodes;
+      std::unordered_set<const BlockPath*> paths; //!< all paths used by the tree
+    };
+
+    Costs m_costs;
+    std::unordered_map<const BlockRailTile*, Tree> m_trees; //!< key is start block
+
+    double cost(const BlockPath& path) const;
+    template<class Filter>
+    Tree search(const BlockRailTile& from, const BlockRailTile* to, Filter filter) const;
+    static Route route(const Tree& tree, const BlockRailTile& to);
+
+  public:
+    const Costs& costs() const
+    {
+      return m_costs;
+    }
+
+    void setCosts(const Costs& value);
+
+    //! \brief Find the shortest route
+    //! \return Empty route if there is no route or \a from equals \a to.
+    Route find(const BlockRailTile& from, const BlockRailTile& to);
+
+    //! \brief Find the shortest route that can be reserved now
+    //! Only paths without reserved conflicting paths into free blocks are used.
+    //! \return Empty route if there is no route or \a from equals \a to.
+    Route findFree(const BlockRailTile& from, const BlockRailTile& to);
+
+    void add(const BlockPath& path);
+    void remove(const BlockPath& path);
+    void remove(const BlockRailTile& block);
+};
+
+#endif
@@ -0,0 +1,204 @@
+/**
+ * server/src/board/map/signalevaluator.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "signalevaluator.hpp"
+#include <algorithm>
+#include <cassert>
+#include "abstractsignalpath.hpp"
+#include "../tile/rail/blockrailtile.hpp"
+#include "../tile/rail/directioncontrolrailtile.hpp"
+#include "../tile/rail/signal/signalrailtile.hpp"
+#include "../tile/rail/turnout/turnoutrailtile.hpp"
+#include "../../core/eventloop.hpp"
+
+SignalEvaluator::Defer::Defer(SignalEvaluator& evaluator)
+  : m_evaluator{evaluator}
+{
+  m_evaluator.m_deferred++;
+}
+
+SignalEvaluator::Defer::~Defer()
+{
+  if(--m_evaluator.m_deferred == 0 && m_evaluator.m_urgent)
+    m_evaluator.evaluate();
+}
+
+void SignalEvaluator::add(AbstractSignalPath& path, RailTile& tile)
+{
+  auto& dependents = m_dependents[&tile];
+
+  if(dependents.tile.expired()) // new entry or a destroyed tile at the same address
+  {
+    dependents.tile = tile.shared_ptr<RailTile>();
+    dependents.paths.clear();
+
+    if(auto* block = dynamic_cast<BlockRailTile*>(&tile))
+    {
+      dependents.connection = block->stateChanged.connect(
+        [this](const BlockRailTile& blockTile, BlockState state)
+        {
+          changed(blockTile, state != BlockState::Free);
+        });
+    }
+    else if(auto* turnout = dynamic_cast<TurnoutRailTile*>(&tile))
+    {
+      dependents.connection = turnout->positionChanged.connect(
+        [this](const TurnoutRailTile& turnoutTile, TurnoutPosition /*position*/)
+        {
+          changed(turnoutTile, true);
+        });
+    }
+    else if(auto* directionControl = dynamic_cast<DirectionControlRailTile*>(&tile))
+    {
+      dependents.connection = directionControl->stateChanged.connect(
+        [this](const DirectionControlRailTile& directionControlTile, DirectionControlState /*state*/)
+        {
+          changed(directionControlTile, true);
+        });
+    }
+    else if(auto* signal = dynamic_cast<SignalRailTile*>(&tile))
+    {
+      dependents.connection = signal->aspectChanged.connect(
+        [this](const SignalRailTile& signalTile, SignalAspect aspect)
+        {
+          changed(signalTile, aspect == SignalAspect::Stop);
+        });
+    }
+    else
+    {
+      assert(false);
+    }
+  }
+
+  if(std::find(dependents.paths.begin(), dependents.paths.end(), &path) == dependents.paths.end())
+  {
+    dependents.paths.emplace_back(&path);
+    path.m_dependencies.emplace_back(&tile);
+  }
+}
+
+void SignalEvaluator::remove(AbstractSignalPath& path)
+{
+  for(const auto* tile : path.m_dependencies)
+  {
+    if(auto it = m_dependents.find(tile); it != m_dependents.end())
+    {
+      auto& paths = it->second.paths;
+      paths.erase(std::remove(paths.begin(), paths.end(), &path), paths.end());
+      if(paths.empty())
+      {
+        m_dependents.erase(it); // disconnects
+      }
+    }
+  }
+  path.m_dependencies.clear();
+
+  if(path.m_dirty)
+  {
+    m_dirty.erase(std::remove(m_dirty.begin(), m_dirty.end(), &path), m_dirty.end());
+    path.m_dirty = false;
+  }
+  // path can be destroyed while a pass is evaluating:
+  std::replace(m_evaluating.begin(), m_evaluating.end(), &path, static_cast<AbstractSignalPath*>(nullptr));
+}
+
+void SignalEvaluator::markDirty(AbstractSignalPath& path)
+{
+  if(path.m_dirty)
+  {
+    m_evaluationsSaved++;
+    return;
+  }
+
+  path.m_dirty = true;
+  m_dirty.emplace_back(&path);
+  if(!m_running) // else evaluated by the next pass
+    schedule();
+}
+
+void SignalEvaluator::evaluate()
+{
+  if(m_running) // e.g. by a script handling an aspect change, dirty paths are evaluated by the next pass
+    return;
+
+  m_running = true;
+  m_scheduled = false;
+  m_urgent = false;
+
+  for(size_t pass = 0; pass < passesMax && !m_dirty.empty(); pass++)
+  {
+    m_evaluating = std::move(m_dirty);
+    m_dirty.clear();
+
+    for(auto* path : m_evaluating)
+    {
+      if(path)
+      {
+        // clear dirty first, a path depending on its own aspect change is evaluated again in the next pass:
+        path->m_dirty = false;
+        path->evaluate();
+        m_evaluations++;
+      }
+    }
+    m_evaluating.clear();
+  }
+
+  m_running = false;
+
+  if(!m_dirty.empty())
+    schedule();
+}
+
+void SignalEvaluator::changed(const RailTile& tile, bool restrictive)
+{
+  if(auto it = m_dependents.find(&tile); it != m_dependents.end())
+  {
+    for(auto* path : it->second.paths)
+    {
+      markDirty(*path);
+    }
+
+    if(restrictive && !m_running)
+    {
+      if(m_deferred != 0)
+        m_urgent = true;
+      else
+        evaluate();
+    }
+  }
+}
+
+void SignalEvaluator::schedule()
+{
+  if(m_scheduled)
+    return;
+
+  m_scheduled = true;
+  EventLoop::call(
+    [weak=weak_from_this()]()
+    {
+      if(auto evaluator = weak.lock(); evaluator && evaluator->m_scheduled)
+      {
+        evaluator->evaluate();
+      }
+    });
+}
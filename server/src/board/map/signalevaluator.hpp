@@ -0,0 +1,118 @@
+/**
+ * server/src/board/map/signalevaluator.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BOARD_MAP_SIGNALEVALUATOR_HPP
+#define TRAINTASTIC_SERVER_BOARD_MAP_SIGNALEVALUATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <boost/signals2/connection.hpp>
+
+class RailTile;
+class AbstractSignalPath;
+
+/**
+ * \brief Batched evaluation of all signal paths of a world
+ *
+ * Keeps a reverse index from each block, turnout, direction control and signal to the
+ * signal paths that depend on it. A state change marks the dependent signal paths dirty.
+ *
+ * A change that can make an aspect more restrictive (a block that is no longer free, a turnout
+ * or direction control that changed, a signal that shows stop) evaluates the dirty paths
+ * immediately, so a signal never shows a less restrictive aspect than allowed. Other changes
+ * are evaluated in a pass posted to the event loop. Within \ref Defer scope, e.g. while
+ * reserving a block path, immediate evaluation is postponed to the end of the scope, so each
+ * signal path is evaluated once.
+ *
+ * Aspect changes during a pass mark the dependent signal paths dirty, these are evaluated by
+ * another pass in the same call, so a chain of signals is updated at once.
+ */
+class SignalEvaluator : public std::enable_shared_from_this<SignalEvaluator>
+{
+  private:
+    struct Dependents
+    {
+      std::weak_ptr<RailTile> tile; //!< to detect a new tile at the address of a destroyed tile
+      boost::signals2::scoped_connection connection;
+      std::vector<AbstractSignalPath*> paths;
+    };
+
+    std::unordered_map<const RailTile*, Dependents> m_dependents;
+    std::vector<AbstractSignalPath*> m_dirty;
+    std::vector<AbstractSignalPath*> m_evaluating; //!< paths of the running pass
+    bool m_scheduled = false;
+    bool m_running = false; //!< \ref evaluate is running
+    bool m_urgent = false; //!< a restrictive change happened within \ref Defer scope
+    size_t m_deferred = 0; //!< nesting level of \ref Defer
+    size_t m_evaluations = 0;
+    size_t m_evaluationsSaved = 0;
+
+    void changed(const RailTile& tile, bool restrictive);
+    void schedule();
+
+  public:
+    //! Maximum number of passes per \ref evaluate call, remaining dirty paths are evaluated later.
+    static constexpr size_t passesMax = 16;
+
+    //! \brief Postpone immediate evaluation to the end of the scope
+    class Defer
+    {
+      private:
+        SignalEvaluator& m_evaluator;
+
+      public:
+        Defer(SignalEvaluator& evaluator);
+        ~Defer();
+
+        Defer(const Defer&) = delete;
+        Defer& operator =(const Defer&) = delete;
+    };
+
+    //! \brief Register that \a path must be evaluated if the state of \a tile changes
+    void add(AbstractSignalPath& path, RailTile& tile);
+
+    //! \brief Remove all dependencies of \a path, must be called before \a path is destroyed
+    void remove(AbstractSignalPath& path);
+
+    //! \brief Mark \a path dirty, it is evaluated in the next batched pass
+    void markDirty(AbstractSignalPath& path);
+
+    //! \brief Evaluate all dirty signal paths now
+    //! Paths marked dirty by aspect changes are evaluated by additional passes, up to \ref passesMax.
+    void evaluate();
+
+    //! \return Number of signal path evaluations
+    size_t evaluations() const
+    {
+      return m_evaluations;
+    }
+
+    //! \return Number of evaluations saved by marking an already dirty signal path dirty again
+    size_t evaluationsSaved() const
+    {
+      return m_evaluationsSaved;
+    }
+};
+
+#endif
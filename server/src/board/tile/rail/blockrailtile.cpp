@@ -31,6 +31,8 @@
 #include "../../../train/trainblockstatus.hpp"
 #include "../../../utils/displayname.hpp"
 #include "../../map/blockpath.hpp"
+#include "../../map/blockpathconflicts.hpp"
+#include "../../map/blockroutes.hpp"
 
 constexpr uint8_t toMask(BlockSide side)
 {
@@ -556,6 +558,11 @@ void BlockRailTile::destroying()
     if(status->train)
       status->train->blocks.removeInternal(status);
 
+  auto& conflicts = m_world.blockPathConflicts();
+  for(const auto& path : m_paths)
+    conflicts.remove(*path);
+  m_world.blockRoutes().remove(*this);
+
   RailTile::destroying();
 }
 
@@ -603,10 +610,10 @@ void BlockRailTile::updatePaths()
   m_paths.clear(); // make sure it is empty, it problably is after the move
   auto found = BlockPath::find(*this);
 
-  while(!current.empty()) // handle existing paths
+  for(auto currentIt = current.begin(); currentIt != current.end();) // handle existing paths
   {
     auto it = std::find_if(found.begin(), found.end(),
-      [&currentPath=*current.front()](const auto& foundPath)
+      [&currentPath=**currentIt](const auto& foundPath)
       {
         return currentPath == *foundPath;
       });
@@ -614,13 +621,22 @@ void BlockRailTile::updatePaths()
     if(it != found.end())
     {
       found.erase(it);
-      m_paths.emplace_back(std::move(current.front()));
+      m_paths.emplace_back(std::move(*currentIt));
+      currentIt = current.erase(currentIt);
+    }
+    else
+    {
+      currentIt++;
     }
-    current.erase(current.begin());
   }
 
+  auto& conflicts = m_world.blockPathConflicts();
+  auto& routes = m_world.blockRoutes();
+
   for(auto& path : current) // no longer existing paths
   {
+    conflicts.remove(*path);
+    routes.remove(*path);
     auto& pathsIn = path->toBlock()->m_pathsIn;
     if(auto it = std::find(pathsIn.begin(), pathsIn.end(), path); it != pathsIn.end())
     {
@@ -630,6 +646,8 @@ void BlockRailTile::updatePaths()
 
   for(auto& path : found) // new paths
   {
+    conflicts.add(*path);
+    routes.add(*path);
     path->toBlock()->m_pathsIn.emplace_back(path);
     m_paths.emplace_back(std::move(path));
   }
@@ -21,6 +21,8 @@
  */
 
 #include "linkrailtile.hpp"
+#include <array>
+#include "../../board.hpp"
 #include "../../list/linkrailtilelist.hpp"
 #include "../../../core/attributes.hpp"
 #include "../../../core/objectlisttablemodel.hpp"
@@ -38,6 +40,9 @@ LinkRailTile::LinkRailTile(World& world, std::string_view _id)
         if(newValue.get() == this)
           return false;
 
+        // paths through the old and new pairs must be updated, see Board::modified():
+        const std::array<LinkRailTile*, 4> modified{{this, link.value().get(), newValue.get(), newValue ? newValue->link.value().get() : nullptr}};
+
         if(link)
         {
           assert(link->link.value().get() == this);
@@ -54,6 +59,10 @@ LinkRailTile::LinkRailTile(World& world, std::string_view _id)
           newValue->link.setValueInternal(shared_ptr<LinkRailTile>());
         }
 
+        for(auto* tile : modified)
+          if(tile)
+            tile->getBoard().tileModified(*tile);
+
         return true;
       }}
 {
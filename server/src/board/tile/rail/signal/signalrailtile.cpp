@@ -85,6 +85,12 @@ bool SignalRailTile::reserve(const std::shared_ptr<BlockPath>& blockPath, bool d
   return true;
 }
 
+void SignalRailTile::destroying()
+{
+  m_signalPath.reset(); // removes it from the signal evaluator
+  StraightRailTile::destroying();
+}
+
 void SignalRailTile::worldEvent(WorldState state, WorldEvent event)
 {
   StraightRailTile::worldEvent(state, event);
@@ -105,7 +111,7 @@ void SignalRailTile::boardModified()
 {
   if(m_signalPath)
   {
-    m_signalPath->evaluate();
+    m_signalPath->scheduleEvaluate();
   }
   StraightRailTile::boardModified();
 }
@@ -130,7 +136,7 @@ void SignalRailTile::evaluate()
 {
   if(m_signalPath) /*[[likely]]*/
   {
-    m_signalPath->evaluate();
+    m_signalPath->scheduleEvaluate();
   }
   else
   {
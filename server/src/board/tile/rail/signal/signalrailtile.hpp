@@ -45,6 +45,7 @@ class SignalRailTile : public StraightRailTile
 
     SignalRailTile(World& world, std::string_view _id, TileId tileId);
 
+    void destroying() override;
     void worldEvent(WorldState state, WorldEvent event) override;
 
     void boardModified() override;
@@ -0,0 +1,164 @@
+/**
+ * server/src/board/tilegrid.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "tilegrid.hpp"
+#include <cassert>
+#include <limits>
+
+namespace {
+
+//! \brief Call \a f for each chunk overlapping the area, with the area clipped to the chunk
+template<class F>
+void forEachChunk(TileLocation origin, uint8_t width, uint8_t height, F&& f)
+{
+  constexpr int size = TileGrid::chunkSize;
+  const int x2 = origin.x + width; // exclusive
+  const int y2 = origin.y + height; // exclusive
+
+  for(int y = origin.y; y < y2; y = (TileChunk::fromTile(y) + 1) * size)
+    for(int x = origin.x; x < x2; x = (TileChunk::fromTile(x) + 1) * size)
+      f(x, y, std::min(x2, (TileChunk::fromTile(x) + 1) * size), std::min(y2, (TileChunk::fromTile(y) + 1) * size));
+}
+
+}
+
+const std::shared_ptr<Tile>& TileGrid::get(TileLocation l) const
+{
+  static const std::shared_ptr<Tile> none;
+
+  if(auto it = m_chunks.find(chunkKey(l.x, l.y)); it != m_chunks.end())
+    if(const uint16_t slot = it->second.cells[cellIndex(l.x, l.y)]; slot != Chunk::noSlot)
+      return it->second.slots[slot - 1].tile;
+
+  return none;
+}
+
+void TileGrid::insert(const std::shared_ptr<Tile>& tile, TileLocation origin, uint8_t width, uint8_t height)
+{
+  assert(tile);
+  assert(width > 0 && height > 0);
+
+  forEachChunk(origin, width, height,
+    [&](int x1, int y1, int x2, int y2)
+    {
+      Chunk& chunk = m_chunks[chunkKey(x1, y1)];
+
+      // reuse a free slot, if any:
+      auto it = chunk.slots.end();
+      if(chunk.used < chunk.slots.size())
+        it = std::find_if(chunk.slots.begin(), chunk.slots.end(),
+          [](const Slot& s)
+          {
+            return !s.tile;
+          });
+      if(it == chunk.slots.end())
+        it = chunk.slots.emplace(chunk.slots.end());
+      *it = Slot{tile, origin, width, height, 0};
+      chunk.used++;
+
+      const auto slot = static_cast<uint16_t>(std::distance(chunk.slots.begin(), it) + 1);
+      for(int y = y1; y < y2; y++)
+        for(int x = x1; x < x2; x++)
+        {
+          auto& cell = chunk.cells[cellIndex(x, y)];
+          assert(cell == Chunk::noSlot);
+          cell = slot;
+          it->cells++;
+        }
+    });
+
+  m_size++;
+}
+
+void TileGrid::erase(TileLocation origin, uint8_t width, uint8_t height)
+{
+  forEachChunk(origin, width, height,
+    [this](int x1, int y1, int x2, int y2)
+    {
+      auto it = m_chunks.find(chunkKey(x1, y1));
+      if(it == m_chunks.end())
+        return;
+
+      Chunk& chunk = it->second;
+      for(int y = y1; y < y2; y++)
+        for(int x = x1; x < x2; x++)
+        {
+          auto& cell = chunk.cells[cellIndex(x, y)];
+          if(cell == Chunk::noSlot)
+            continue;
+
+          Slot& s = chunk.slots[cell - 1];
+          cell = Chunk::noSlot;
+          if(--s.cells == 0)
+          {
+            // count the tile in the chunk of its origin:
+            if(chunkKey(s.origin.x, s.origin.y) == it->first)
+              m_size--;
+            s.tile.reset();
+            chunk.used--;
+          }
+        }
+
+      if(chunk.used == 0)
+        m_chunks.erase(it);
+    });
+}
+
+void TileGrid::clear()
+{
+  m_chunks.clear();
+  m_size = 0;
+}
+
+bool TileGrid::bounds(TileLocation& min, TileLocation& max) const
+{
+  if(m_chunks.empty())
+    return false;
+
+  int xMin = std::numeric_limits<int>::max();
+  int yMin = std::numeric_limits<int>::max();
+  int xMax = std::numeric_limits<int>::min();
+  int yMax = std::numeric_limits<int>::min();
+
+  for(const auto& it : m_chunks)
+    for(const Slot& s : it.second.slots)
+      if(s.tile)
+      {
+        xMin = std::min<int>(xMin, s.origin.x);
+        yMin = std::min<int>(yMin, s.origin.y);
+        xMax = std::max(xMax, s.origin.x + s.width - 1);
+        yMax = std::max(yMax, s.origin.y + s.height - 1);
+      }
+
+  min = {static_cast<int16_t>(xMin), static_cast<int16_t>(yMin)};
+  max = {static_cast<int16_t>(xMax), static_cast<int16_t>(yMax)};
+  return true;
+}
+
+size_t TileGrid::memoryUsage() const
+{
+  constexpr size_t mapNodeOverhead = 4 * sizeof(void*); // color, parent, left and right
+  size_t size = sizeof(*this);
+  for(const auto& it : m_chunks)
+    size += mapNodeOverhead + sizeof(it) + it.second.slots.capacity() * sizeof(Slot);
+  return size;
+}
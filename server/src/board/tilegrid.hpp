@@ -0,0 +1,185 @@
+/**
+ * server/src/board/tilegrid.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BOARD_TILEGRID_HPP
+#define TRAINTASTIC_SERVER_BOARD_TILEGRID_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <traintastic/board/tilechunk.hpp>
+#include <traintastic/board/tilelocation.hpp>
+
+class Tile;
+
+/**
+ * \brief Tiles of a board, stored in chunks of TileChunk::size x TileChunk::size cells
+ *
+ * Each chunk has a list of the tiles covering at least one of its cells and a dense
+ * cell index into that list, a multi cell tile is stored once per chunk instead of
+ * once per cell. Chunks are ordered by row and column, iterating the tiles is
+ * in chunk order, within a chunk in row order of the tile origins.
+ */
+class TileGrid
+{
+  public:
+    static constexpr int chunkSize = TileChunk::size;
+
+  private:
+    struct Slot
+    {
+      std::shared_ptr<Tile> tile; //!< \c nullptr if slot is free
+      TileLocation origin;
+      uint8_t width;
+      uint8_t height;
+      uint16_t cells; //!< number of cells of the chunk covered by the tile
+    };
+
+    struct Chunk
+    {
+      static constexpr uint16_t noSlot = 0;
+
+      std::array<uint16_t, chunkSize * chunkSize> cells{}; //!< slot index + 1, or \ref noSlot
+      std::vector<Slot> slots;
+      uint16_t used = 0; //!< number of used slots
+    };
+
+    using ChunkKey = std::pair<int16_t, int16_t>; //!< chunk y, x: ordered by row
+
+    std::map<ChunkKey, Chunk> m_chunks;
+    size_t m_size = 0;
+
+    static ChunkKey chunkKey(int x, int y)
+    {
+      return {TileChunk::fromTile(y), TileChunk::fromTile(x)};
+    }
+
+    static size_t cellIndex(int x, int y)
+    {
+      return static_cast<size_t>((y - TileChunk::fromTile(y) * chunkSize) * chunkSize + (x - TileChunk::fromTile(x) * chunkSize));
+    }
+
+    static TileLocation cellLocation(const ChunkKey& key, size_t index)
+    {
+      return {
+        static_cast<int16_t>(key.second * chunkSize + static_cast<int>(index % chunkSize)),
+        static_cast<int16_t>(key.first * chunkSize + static_cast<int>(index / chunkSize))};
+    }
+
+    template<class F>
+    static void forEachOrigin(const ChunkKey& key, const Chunk& chunk, F&& f)
+    {
+      for(size_t i = 0; i < chunk.cells.size(); i++)
+        if(const uint16_t slot = chunk.cells[i]; slot != Chunk::noSlot)
+          if(const Slot& s = chunk.slots[slot - 1]; s.origin == cellLocation(key, i))
+            f(s.tile);
+    }
+
+  public:
+    //! \return Tile at \a l or \c nullptr if there is no tile
+    const std::shared_ptr<Tile>& get(TileLocation l) const;
+
+    bool contains(TileLocation l) const
+    {
+      return get(l).operator bool();
+    }
+
+    bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    //! \return Number of tiles, a multi cell tile counts as one
+    size_t size() const
+    {
+      return m_size;
+    }
+
+    //! \brief Place \a tile at all cells of the \a width x \a height area at \a origin
+    //! \note The cells must be empty.
+    void insert(const std::shared_ptr<Tile>& tile, TileLocation origin, uint8_t width, uint8_t height);
+
+    //! \brief Remove the tile(s) from all cells of the \a width x \a height area at \a origin
+    void erase(TileLocation origin, uint8_t width, uint8_t height);
+
+    void clear();
+
+    //! \brief Get the inclusive bounds of all covered cells
+    //! \return \c false if there are no tiles
+    bool bounds(TileLocation& min, TileLocation& max) const;
+
+    //! \return Approximate memory used by the grid in bytes
+    size_t memoryUsage() const;
+
+    //! \brief Call \a f for each tile once, in chunk order
+    template<class F>
+    void forEach(F&& f) const
+    {
+      for(const auto& [key, chunk] : m_chunks)
+        forEachOrigin(key, chunk, f);
+    }
+
+    //! \brief Call \a f for each tile with its origin in \a chunk
+    template<class F>
+    void forEach(const TileChunk& chunk, F&& f) const
+    {
+      if(auto it = m_chunks.find({chunk.y, chunk.x}); it != m_chunks.end())
+        forEachOrigin(it->first, it->second, f);
+    }
+
+    //! \brief Call \a f once for each tile covering at least one cell of the inclusive rectangle \a min - \a max
+    template<class F>
+    void forEach(TileLocation min, TileLocation max, F&& f) const
+    {
+      const auto keyMin = chunkKey(min.x, min.y);
+      const auto keyMax = chunkKey(max.x, max.y);
+      for(int row = keyMin.first; row <= keyMax.first; row++)
+      {
+        for(auto it = m_chunks.lower_bound({static_cast<int16_t>(row), keyMin.second}); it != m_chunks.end() && it->first.first == row && it->first.second <= keyMax.second; ++it)
+        {
+          const Chunk& chunk = it->second;
+          const int left = it->first.second * chunkSize;
+          const int top = row * chunkSize;
+          const int x1 = std::max<int>(min.x, left);
+          const int y1 = std::max<int>(min.y, top);
+          const int x2 = std::min<int>(max.x, left + chunkSize - 1);
+          const int y2 = std::min<int>(max.y, top + chunkSize - 1);
+
+          for(int y = y1; y <= y2; y++)
+            for(int x = x1; x <= x2; x++)
+              if(const uint16_t slot = chunk.cells[static_cast<size_t>((y - top) * chunkSize + (x - left))]; slot != Chunk::noSlot)
+              {
+                // report a tile at its first cell within the rectangle:
+                const Slot& s = chunk.slots[slot - 1];
+                if(x == std::max<int>(s.origin.x, min.x) && y == std::max<int>(s.origin.y, min.y))
+                  f(s.tile);
+              }
+        }
+      }
+    }
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "abstractobjectlist.hpp"
 #include "../core/idobject.hpp"
 #include "../world/worldloader.hpp"
+#include "../world/worldsaver.hpp"
 
 AbstractObjectList::AbstractObjectList(Object& _parent, std::string_view parentPropertyName)
   : SubObject{_parent, parentPropertyName}
@@ -50,6 +51,9 @@ void AbstractObjectList::save(WorldSaver& saver, nlohmann::json& data, nlohmann:
 {
   SubObject::save(saver, data, state);
 
+  if(saver.isStateOnly())
+    return;
+
   nlohmann::json objects = nlohmann::json::array();
   for(auto& item: getItems())
     if(IdObject* idObject = dynamic_cast<IdObject*>(item.get()))
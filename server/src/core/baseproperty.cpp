@@ -22,9 +22,18 @@
 
 #include "baseproperty.hpp"
 #include "object.hpp"
+#include "../world/worldjournal.hpp"
+#include "../world/worldstatecheckpoint.hpp"
 
 void BaseProperty::changed()
 {
   if(!m_object.dying())
+  {
+    s_changeCounter++;
     m_object.propertyChanged(*this);
+    if(isStoreable())
+      WorldJournal::changed(m_object);
+    else if(isStateStoreable())
+      WorldStateCheckpoint::changed(m_object);
+  }
 }
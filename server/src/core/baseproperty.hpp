@@ -31,6 +31,9 @@
 
 class BaseProperty : public InterfaceItem
 {
+  private:
+    inline static uint64_t s_changeCounter = 0;
+
   protected:
     const ValueType m_type;
     const PropertyFlags m_flags;
@@ -49,6 +52,13 @@ class BaseProperty : public InterfaceItem
     void changed();
 
   public:
+    //! \brief Property change counter
+    //! Incremented on every property change, can be used to detect if any property changed since.
+    static uint64_t changeCounter()
+    {
+      return s_changeCounter;
+    }
+
     bool isWriteable() const
     {
       return (m_flags & PropertyFlagsAccessMask) == PropertyFlags::ReadWrite;
@@ -71,6 +71,13 @@ std::string ControllerListBaseTableModel::getText(uint32_t column, uint32_t row)
   return "";
 }
 
+std::string ControllerListBaseTableModel::getRowId(uint32_t row) const
+{
+  if(row < rowCount())
+    return m_list->m_items[row]->getObjectId();
+  return {};
+}
+
 void ControllerListBaseTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   if(property.name() == "id")
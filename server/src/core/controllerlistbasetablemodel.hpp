@@ -44,6 +44,7 @@ class ControllerListBaseTableModel final : public TableModel
     ControllerListBaseTableModel(ControllerListBase& list);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getRowId(uint32_t row) const final;
 };
 
 #endif
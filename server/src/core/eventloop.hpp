@@ -25,6 +25,7 @@
 
 #include <thread>
 #include <boost/asio/io_context.hpp>
+#include "eventloopstatistics.hpp"
 
 class EventLoop
 {
@@ -37,6 +38,7 @@ class EventLoop
 
   public:
     inline static boost::asio::io_context ioContext;
+    inline static EventLoopStatistics statistics;
 #ifdef TRAINTASTIC_TEST
     inline static std::thread::id threadId;
 #else
@@ -60,7 +62,14 @@ class EventLoop
     template<typename _Callable, typename... _Args>
     inline static void call(_Callable&& __f, _Args&&... __args)
     {
-      ioContext.post(std::bind(__f, __args...));
+      statistics.posted();
+      ioContext.post(
+        [handler=std::bind(__f, __args...), posted=EventLoopStatistics::Clock::now()]() mutable
+        {
+          const auto started = EventLoopStatistics::Clock::now();
+          handler();
+          statistics.handled(posted, started);
+        });
     }
 };
 
@@ -0,0 +1,239 @@
+/**
+ * server/src/core/eventloopqueue.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "eventloopqueue.hpp"
+#include <exception>
+#include "eventloop.hpp"
+
+EventLoopQueue::State::State(boost::asio::io_context& ioContext_)
+  : ioContext{ioContext_}
+{
+}
+
+EventLoopQueue::State::~State()
+{
+  destroyList(head);
+  while(free)
+    delete std::exchange(free, free->next);
+}
+
+EventLoopQueue::EventLoopQueue()
+  : EventLoopQueue(EventLoop::ioContext)
+{
+}
+
+EventLoopQueue::EventLoopQueue(boost::asio::io_context& ioContext)
+  : m_state{std::make_shared<State>(ioContext)}
+{
+}
+
+EventLoopQueue::~EventLoopQueue()
+{
+  std::lock_guard<std::mutex> lock(m_state->mutex);
+  m_state->closed = true;
+}
+
+EventLoopQueue::Node* EventLoopQueue::acquireNode()
+{
+  if(m_state->free)
+  {
+    m_state->freeCount--;
+    return std::exchange(m_state->free, m_state->free->next);
+  }
+  return new Node;
+}
+
+void EventLoopQueue::enqueue(std::unique_lock<std::mutex>& lock, Node* node)
+{
+  node->next = nullptr;
+  if(m_state->tail)
+    m_state->tail->next = node;
+  else
+    m_state->head = node;
+  m_state->tail = node;
+
+  EventLoop::statistics.posted();
+
+  if(m_state->scheduled)
+    return;
+
+  m_state->scheduled = true;
+  lock.unlock();
+  post(m_state);
+}
+
+void EventLoopQueue::post(const std::shared_ptr<State>& state)
+{
+  state->ioContext.post(
+    [weak=std::weak_ptr<State>(state)]()
+    {
+      if(auto s = weak.lock())
+        drain(s);
+    });
+}
+
+void EventLoopQueue::drain(const std::shared_ptr<State>& state)
+{
+  // releases the handled nodes and puts back the nodes not handled, also if a call throws:
+  class Batch
+  {
+    private:
+      const std::shared_ptr<State>& m_state;
+      const int m_exceptions;
+      Node* m_handled = nullptr;
+      Node* m_handledLast = nullptr;
+      size_t m_handledCount = 0;
+
+    public:
+      Node* next; //!< first node not handled
+      Node* const last;
+      Node* current = nullptr; //!< node being handled
+
+      Batch(const std::shared_ptr<State>& state, Node* first, Node* last_)
+        : m_state{state}
+        , m_exceptions{std::uncaught_exceptions()}
+        , next{first}
+        , last{last_}
+      {
+      }
+
+      ~Batch()
+      {
+        if(current) // call threw
+        {
+          EventLoop::statistics.discarded();
+          done();
+        }
+
+        bool repost = false;
+        {
+          std::lock_guard<std::mutex> lock(m_state->mutex);
+
+          if(m_handled)
+            releaseList(*m_state, m_handled, m_handledLast, m_handledCount);
+
+          if(next) // in front of the calls queued while handling the batch
+          {
+            last->next = m_state->head;
+            if(!m_state->head)
+              m_state->tail = last;
+            m_state->head = next;
+          }
+
+          if(std::uncaught_exceptions() > m_exceptions) // drain is aborted, post again if needed
+          {
+            repost = m_state->head;
+            m_state->scheduled = repost;
+          }
+        }
+
+        if(repost)
+          post(m_state);
+      }
+
+      Batch(const Batch&) = delete;
+      Batch& operator =(const Batch&) = delete;
+
+      void done()
+      {
+        Node* node = std::exchange(current, nullptr);
+        node->destroy(*node);
+        node->next = nullptr;
+        if(m_handledLast)
+          m_handledLast->next = node;
+        else
+          m_handled = node;
+        m_handledLast = node;
+        m_handledCount++;
+      }
+  };
+
+  size_t count = 0;
+
+  for(;;)
+  {
+    Node* first = nullptr;
+    Node* last = nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+
+      // calls queued while draining are handled by the same drain handler, up to a limit:
+      if(!state->head)
+      {
+        state->scheduled = false;
+        return;
+      }
+      if(count >= drainCallsMax)
+        break; // still scheduled, post again
+
+      first = std::exchange(state->head, nullptr);
+      last = std::exchange(state->tail, nullptr);
+    }
+
+    Batch batch(state, first, last);
+    while(batch.next && count < drainCallsMax)
+    {
+      Node* node = batch.current = std::exchange(batch.next, batch.next->next);
+      if(!state->closed) // only modified by the event loop thread
+      {
+        const auto started = EventLoopStatistics::Clock::now();
+        node->invoke(*node);
+        EventLoop::statistics.handled(node->posted, started);
+      }
+      else
+        EventLoop::statistics.discarded();
+      batch.done();
+      count++;
+    }
+  }
+
+  post(state);
+}
+
+void EventLoopQueue::releaseList(State& state, Node* first, Node* last, size_t count)
+{
+  if(state.freeCount + count <= freeNodesMax)
+  {
+    last->next = state.free;
+    state.free = first;
+    state.freeCount += count;
+  }
+  else
+  {
+    while(first)
+      delete std::exchange(first, first->next);
+  }
+}
+
+void EventLoopQueue::destroyList(Node* node)
+{
+  uint32_t count = 0;
+  while(node)
+  {
+    node->destroy(*node);
+    delete std::exchange(node, node->next);
+    count++;
+  }
+  if(count != 0)
+    EventLoop::statistics.discarded(count);
+}
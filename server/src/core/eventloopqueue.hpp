@@ -0,0 +1,144 @@
+/**
+ * server/src/core/eventloopqueue.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_CORE_EVENTLOOPQUEUE_HPP
+#define TRAINTASTIC_SERVER_CORE_EVENTLOOPQUEUE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <boost/asio/io_context.hpp>
+#include "eventloopstatistics.hpp"
+
+//! \brief Multiple producer, single consumer queue for calls into the event loop
+//!
+//! Posting to the event loop using \ref EventLoop::call allocates a handler for every call
+//! and wakes up the event loop for every call. This queue stores calls in recycled nodes and
+//! posts a single drain handler for all calls queued until the event loop gets to it.
+//! Calls are executed in the order they are queued.
+//!
+//! Calls that are still queued when the queue is destroyed are discarded, as they most likely
+//! refer to the object owning the queue.
+class EventLoopQueue
+{
+  public:
+    //! Callables up to this size are stored inside the node, larger ones are heap allocated.
+    static constexpr size_t storageSize = 64;
+
+    //! Maximum number of nodes kept for reuse.
+    static constexpr size_t freeNodesMax = 1024;
+
+    //! Maximum number of calls executed by a single drain handler,
+    //! if more calls are queued the drain handler is posted again to give other handlers a chance.
+    static constexpr size_t drainCallsMax = 256;
+
+  private:
+    struct Node
+    {
+      Node* next;
+      EventLoopStatistics::Clock::time_point posted;
+      void (*invoke)(Node&);
+      void (*destroy)(Node&);
+      alignas(std::max_align_t) std::byte storage[storageSize];
+    };
+
+    template<typename T>
+    static constexpr bool storeInline = sizeof(T) <= storageSize && alignof(T) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<T>;
+
+    struct State
+    {
+      boost::asio::io_context& ioContext;
+      std::mutex mutex;
+      Node* head = nullptr; //!< first queued node
+      Node* tail = nullptr; //!< last queued node
+      Node* free = nullptr; //!< recycled nodes
+      size_t freeCount = 0;
+      bool scheduled = false; //!< drain handler is posted
+      bool closed = false; //!< queue owner is gone, discard calls
+
+      State(boost::asio::io_context& ioContext_);
+      ~State();
+    };
+
+    std::shared_ptr<State> m_state;
+
+    Node* acquireNode(); // must be called with mutex locked
+    void enqueue(std::unique_lock<std::mutex>& lock, Node* node);
+    static void post(const std::shared_ptr<State>& state);
+    static void drain(const std::shared_ptr<State>& state);
+    static void releaseList(State& state, Node* first, Node* last, size_t count); // must be called with mutex locked
+    static void destroyList(Node* node);
+
+  public:
+    EventLoopQueue();
+    EventLoopQueue(boost::asio::io_context& ioContext);
+    ~EventLoopQueue();
+
+    EventLoopQueue(const EventLoopQueue&) = delete;
+    EventLoopQueue& operator =(const EventLoopQueue&) = delete;
+
+    //! \brief Queue a call into the event loop
+    //! \note Thread safe
+    template<typename Func>
+    void call(Func&& f)
+    {
+      using F = std::decay_t<Func>;
+
+      std::unique_lock<std::mutex> lock(m_state->mutex);
+      Node* node = acquireNode();
+      node->posted = EventLoopStatistics::Clock::now();
+      if constexpr(storeInline<F>)
+      {
+        new(node->storage) F(std::forward<Func>(f));
+        node->invoke =
+          [](Node& n)
+          {
+            (*std::launder(reinterpret_cast<F*>(n.storage)))();
+          };
+        node->destroy =
+          [](Node& n)
+          {
+            std::launder(reinterpret_cast<F*>(n.storage))->~F();
+          };
+      }
+      else
+      {
+        new(node->storage) F*(new F(std::forward<Func>(f)));
+        node->invoke =
+          [](Node& n)
+          {
+            (**std::launder(reinterpret_cast<F**>(n.storage)))();
+          };
+        node->destroy =
+          [](Node& n)
+          {
+            delete *std::launder(reinterpret_cast<F**>(n.storage));
+          };
+      }
+      enqueue(lock, node);
+    }
+};
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * server/src/core/eventloopstatistics.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "eventloopstatistics.hpp"
+#include "../log/log.hpp"
+
+size_t EventLoopStatistics::histogramIndex(std::chrono::microseconds duration)
+{
+  size_t index = 0;
+  for(auto n = duration.count(); n > 0 && index < histogramSize - 1; n >>= 1)
+    index++;
+  return index;
+}
+
+void EventLoopStatistics::handled(Clock::time_point posted, Clock::time_point started)
+{
+  const auto finished = Clock::now();
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(started - posted);
+  const auto executionTime = std::chrono::duration_cast<std::chrono::microseconds>(finished - started);
+
+  m_queueDepth--;
+  m_handled++;
+
+  m_latencyHistogram[histogramIndex(latency)]++;
+  if(latency > m_latencyMax)
+    m_latencyMax = latency;
+
+  m_executionTimeHistogram[histogramIndex(executionTime)]++;
+  if(executionTime > m_executionTimeMax)
+    m_executionTimeMax = executionTime;
+
+  if(stallThreshold.count() > 0 && executionTime >= stallThreshold)
+  {
+    m_stalls++;
+    Log::log(logId, LogMessage::W1004_EVENT_LOOP_HANDLER_TOOK_X_MS, std::chrono::duration_cast<std::chrono::milliseconds>(executionTime).count());
+  }
+}
@@ -0,0 +1,96 @@
+/**
+ * server/src/core/eventloopstatistics.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_CORE_EVENTLOOPSTATISTICS_HPP
+#define TRAINTASTIC_SERVER_CORE_EVENTLOOPSTATISTICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+//! \brief Event loop instrumentation
+//!
+//! Collects post-to-run latency, handler execution time and queue depth of
+//! handlers posted using \ref EventLoop::call.
+//! Except for the queue depth all members may only be accessed by the event loop thread.
+class EventLoopStatistics
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    //! Histogram bucket 0 counts durations < 1us, bucket n counts durations in [2^(n-1), 2^n) us,
+    //! the last bucket counts all durations above that.
+    static constexpr size_t histogramSize = 21;
+    using Histogram = std::array<uint32_t, histogramSize>;
+
+    static constexpr std::string_view logId{"event_loop"};
+    static constexpr std::chrono::milliseconds stallThresholdDefault{100};
+
+  private:
+    std::atomic<uint32_t> m_queueDepth = 0;
+    std::atomic<uint32_t> m_queueDepthMax = 0;
+    uint32_t m_handled = 0;
+    uint32_t m_stalls = 0;
+    std::chrono::microseconds m_latencyMax{0};
+    std::chrono::microseconds m_executionTimeMax{0};
+    Histogram m_latencyHistogram = {};
+    Histogram m_executionTimeHistogram = {};
+
+    static size_t histogramIndex(std::chrono::microseconds duration);
+
+  public:
+    std::chrono::microseconds stallThreshold = stallThresholdDefault;
+
+    //! \brief Register a posted handler
+    //! \note Thread safe
+    inline void posted()
+    {
+      const uint32_t depth = ++m_queueDepth;
+      uint32_t max = m_queueDepthMax.load(std::memory_order_relaxed);
+      while(depth > max && !m_queueDepthMax.compare_exchange_weak(max, depth, std::memory_order_relaxed));
+    }
+
+    //! \brief Register posted handlers that are destroyed without being called
+    //! \note Thread safe
+    inline void discarded(uint32_t count = 1)
+    {
+      m_queueDepth -= count;
+    }
+
+    //! \brief Register a completed handler
+    //! \param[in] posted Time the handler was posted
+    //! \param[in] started Time the handler was started
+    void handled(Clock::time_point posted, Clock::time_point started);
+
+    inline uint32_t queueDepth() const { return m_queueDepth.load(std::memory_order_relaxed); }
+    inline uint32_t queueDepthMax() const { return m_queueDepthMax.load(std::memory_order_relaxed); }
+    inline uint32_t handledCount() const { return m_handled; }
+    inline uint32_t stalls() const { return m_stalls; }
+    inline std::chrono::microseconds latencyMax() const { return m_latencyMax; }
+    inline std::chrono::microseconds executionTimeMax() const { return m_executionTimeMax; }
+    inline const Histogram& latencyHistogram() const { return m_latencyHistogram; }
+    inline const Histogram& executionTimeHistogram() const { return m_executionTimeHistogram; }
+};
+
+#endif
@@ -21,6 +21,7 @@
 #include "idobject.hpp"
 #include "../traintastic/traintastic.hpp"
 #include "../world/getworld.hpp"
+#include "../world/worldjournal.hpp"
 #include "attributes.hpp"
 #include "isvalidobjectid.hpp"
 #include "../utils/displayname.hpp"
@@ -39,6 +40,7 @@ IdObject::IdObject(World& world, std::string_view _id) :
       auto n = m.extract(id);
       n.key() = value;
       m.insert(std::move(n));
+      WorldJournal::renamed(m_world, *this, id, value);
       return true;
     }}
 {
@@ -57,12 +59,17 @@ IdObject::~IdObject()
 void IdObject::destroying()
 {
   m_world.m_objects.erase(id);
+  m_world.m_saveCache.invalidate(*this);
+  if(m_world.m_journal)
+    m_world.m_journal->objectDeleted(id);
   Object::destroying();
 }
 
 void IdObject::addToWorld()
 {
   m_world.m_objects.emplace(id, weak_from_this());
+  if(m_world.m_journal)
+    m_world.m_journal->objectChanged(*this);
 }
 
 void IdObject::worldEvent(WorldState state, WorldEvent event)
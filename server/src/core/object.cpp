@@ -119,7 +119,9 @@ void Object::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state
     {
       if(baseProperty->isStoreable())
       {
-        data[std::string{baseProperty->name()}] = toJSON(saver, *baseProperty);
+        // only sub objects can contain state:
+        if(!saver.isStateOnly() || (baseProperty->type() == ValueType::Object && contains(baseProperty->flags(), PropertyFlags::SubObject)))
+          data[std::string{baseProperty->name()}] = toJSON(saver, *baseProperty);
       }
       else if(baseProperty->isStateStoreable())
       {
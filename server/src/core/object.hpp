@@ -116,6 +116,10 @@ class Object : public std::enable_shared_from_this<Object>
     virtual std::string_view getClassId() const = 0;
     virtual std::string getObjectId() const = 0;
 
+    //! \brief Object this object is part of
+    //! \return \c nullptr for objects that aren't part of another object, e.g. \ref IdObject
+    virtual Object* parentObject() const { return nullptr; }
+
     const InterfaceItems& interfaceItems() const { return m_interfaceItems; }
 
     const InterfaceItem* getItem(std::string_view name) const;
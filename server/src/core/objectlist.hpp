@@ -27,6 +27,7 @@
 #include <cassert>
 #include "idobject.hpp"
 #include "subobject.hpp"
+#include "../world/worldjournal.hpp"
 
 template<typename T>
 class ObjectListTableModel;
@@ -92,7 +93,7 @@ class ObjectList : public AbstractObjectList
           if(m_items[row] == obj)
           {
             for(auto& model : m_models)
-              model->propertyChanged(property, row);
+              model->itemChanged(property, row);
             break;
           }
       }
@@ -100,18 +101,16 @@ class ObjectList : public AbstractObjectList
 
     void rowCountChanged()
     {
-      const auto size = m_items.size();
-      length.setValueInternal(static_cast<uint32_t>(size));
+      length.setValueInternal(static_cast<uint32_t>(m_items.size()));
       for(auto& model : m_models)
-        model->setRowCount(static_cast<uint32_t>(size));
+        model->itemsReset();
     }
 
     void rowsChanged(uint32_t first, uint32_t last)
     {
       for(auto& model : m_models)
-      {
-        model->rowsChanged(first, last);
-      }
+        model->itemsReordered(first, last);
+      WorldJournal::changed(*this);
     }
 
   public:
@@ -155,7 +154,10 @@ class ObjectList : public AbstractObjectList
       m_propertyChanged.emplace(object.get(), object->propertyChanged.connect(std::bind(&ObjectList<T>::propertyChanged, this, std::placeholders::_1)));
       m_items.emplace_back(std::move(object));
       objectAdded(m_items.back());
-      rowCountChanged();
+      length.setValueInternal(static_cast<uint32_t>(m_items.size()));
+      for(auto& model : m_models)
+        model->itemAdded();
+      WorldJournal::changed(*this);
     }
 
     void removeObject(const std::shared_ptr<T>& object)
@@ -165,15 +167,13 @@ class ObjectList : public AbstractObjectList
       {
         m_propertyChanged[object.get()].disconnect();
         m_propertyChanged.erase(object.get());
+        const uint32_t row = static_cast<uint32_t>(std::distance(m_items.begin(), it));
         m_items.erase(it);
         objectRemoved(object);
-        rowCountChanged();
-
-        uint32_t row = std::distance(m_items.begin(), it);
+        length.setValueInternal(static_cast<uint32_t>(m_items.size()));
         for(auto& model : m_models)
-        {
-          model->rowRemovedHack(row);
-        }
+          model->itemRemoved(*object, row);
+        WorldJournal::changed(*this);
       }
     }
 };
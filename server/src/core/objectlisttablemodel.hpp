@@ -24,8 +24,19 @@
 #define TRAINTASTIC_SERVER_CORE_OBJECTLISTTABLEMODEL_HPP
 
 #include "tablemodel.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
 #include "objectlist.hpp"
+#include "../utils/toupper.hpp"
 
+//! \brief Table model for an object list
+//!
+//! Rows can be sorted and/or filtered by the client, see \ref setSortFilter.
+//! The sorted/filtered rows are kept in a view that is updated incrementally when objects are
+//! added, removed or changed, clients receive the inserted, removed and moved rows instead of
+//! reloading their region. Rows are sorted on \ref getSortKey and sent with the object id, see
+//! \ref getRowId, so clients don't have to identify a row by its index.
 template<typename T>
 class ObjectListTableModel : public TableModel
 {
@@ -33,11 +44,202 @@ class ObjectListTableModel : public TableModel
 
   private:
     std::shared_ptr<ObjectList<T>> m_list;
+    bool m_viewActive = false; //!< rows are sorted and/or filtered
+    std::vector<const T*> m_view; //!< visible items in row order, only used if \ref m_viewActive is set
+    uint32_t m_sortColumn = noSortColumn;
+    bool m_sortDescending = false;
+    std::string m_filter; //!< upper case
+    mutable const T* m_probe = nullptr; //!< item returned by \ref getItem while getting its text or sort key for sorting/filtering
+
+    std::string getItemText(uint32_t column, const T& item) const
+    {
+      m_probe = &item;
+      std::string text = getText(column, 0);
+      m_probe = nullptr;
+      return text;
+    }
+
+    SortKey getItemSortKey(const T& item) const
+    {
+      m_probe = &item;
+      SortKey key = getSortKey(m_sortColumn, 0);
+      m_probe = nullptr;
+      return key;
+    }
+
+    bool sortsBefore(const SortKey& a, const SortKey& b) const
+    {
+      const int r = compareSortKey(a, b);
+      return m_sortDescending ? r > 0 : r < 0;
+    }
+
+    bool isVisible(const T& item) const
+    {
+      if(m_filter.empty())
+        return true;
+      for(uint32_t column = 0; column < columnCount(); column++)
+      {
+        std::string text = getItemText(column, item);
+        if(toUpper(text).find(m_filter) != std::string::npos)
+          return true;
+      }
+      return false;
+    }
+
+    //! \brief Row the item should be inserted at in the view
+    uint32_t viewPosition(const T& item) const
+    {
+      if(m_sortColumn == noSortColumn) // keep list order
+      {
+        uint32_t position = 0;
+        for(const auto& listItem : m_list->m_items)
+        {
+          if(listItem.get() == &item)
+            break;
+          if(position < m_view.size() && m_view[position] == listItem.get())
+            position++;
+        }
+        return position;
+      }
+
+      const SortKey key = getItemSortKey(item);
+      auto it = std::upper_bound(m_view.begin(), m_view.end(), key,
+        [this](const SortKey& k, const T* viewItem)
+        {
+          return sortsBefore(k, getItemSortKey(*viewItem));
+        });
+      return static_cast<uint32_t>(std::distance(m_view.begin(), it));
+    }
+
+    void rebuildView()
+    {
+      const uint32_t oldRowCount = rowCount();
+
+      m_view.clear();
+      if(m_viewActive)
+      {
+        std::vector<std::pair<SortKey, const T*>> items;
+        for(const auto& item : m_list->m_items)
+          if(isVisible(*item))
+            items.emplace_back(m_sortColumn != noSortColumn ? getItemSortKey(*item) : SortKey(), item.get());
+
+        if(m_sortColumn != noSortColumn)
+          std::stable_sort(items.begin(), items.end(),
+            [this](const auto& a, const auto& b)
+            {
+              return sortsBefore(a.first, b.first);
+            });
+
+        m_view.reserve(items.size());
+        for(const auto& item : items)
+          m_view.emplace_back(item.second);
+      }
+
+      removeRows(0, oldRowCount);
+      insertRows(0, static_cast<uint32_t>(m_viewActive ? m_view.size() : m_list->m_items.size()));
+    }
+
+    void itemAdded()
+    {
+      const T& item = *m_list->m_items.back();
+      if(!m_viewActive)
+        insertRows(rowCount(), 1);
+      else if(isVisible(item))
+      {
+        const uint32_t row = viewPosition(item);
+        m_view.insert(m_view.begin() + row, &item);
+        insertRows(row, 1);
+      }
+    }
+
+    void itemRemoved(const T& item, uint32_t listRow)
+    {
+      if(!m_viewActive)
+        removeRows(listRow, 1);
+      else if(auto it = std::find(m_view.begin(), m_view.end(), &item); it != m_view.end())
+      {
+        const uint32_t row = static_cast<uint32_t>(std::distance(m_view.begin(), it));
+        m_view.erase(it);
+        removeRows(row, 1);
+      }
+    }
+
+    void itemChanged(BaseProperty& property, uint32_t listRow)
+    {
+      if(!m_viewActive)
+      {
+        propertyChanged(property, listRow);
+        return;
+      }
+
+      const T& item = *m_list->m_items[listRow];
+      const bool visible = isVisible(item);
+      auto it = std::find(m_view.begin(), m_view.end(), &item);
+      if(it == m_view.end())
+      {
+        if(visible)
+        {
+          const uint32_t row = viewPosition(item);
+          m_view.insert(m_view.begin() + row, &item);
+          insertRows(row, 1);
+        }
+        return;
+      }
+
+      uint32_t row = static_cast<uint32_t>(std::distance(m_view.begin(), it));
+      if(!visible)
+      {
+        m_view.erase(it);
+        removeRows(row, 1);
+        return;
+      }
+
+      if(m_sortColumn != noSortColumn)
+      {
+        const SortKey key = getItemSortKey(item);
+        if((row > 0 && sortsBefore(key, getItemSortKey(*m_view[row - 1]))) ||
+            (row + 1 < m_view.size() && sortsBefore(getItemSortKey(*m_view[row + 1]), key)))
+        {
+          m_view.erase(it);
+          const uint32_t to = viewPosition(item);
+          m_view.insert(m_view.begin() + to, &item);
+          moveRow(row, to);
+          row = to;
+        }
+      }
+
+      propertyChanged(property, row);
+    }
+
+    void itemsReordered(uint32_t first, uint32_t last)
+    {
+      if(!m_viewActive)
+        rowsChanged(first, last);
+      else if(m_sortColumn == noSortColumn)
+        rebuildView();
+    }
+
+    void itemsReset()
+    {
+      if(!m_viewActive)
+        setRowCount(static_cast<uint32_t>(m_list->m_items.size()));
+      else
+        rebuildView();
+    }
 
   protected:
     static constexpr uint32_t invalidColumn = std::numeric_limits<uint32_t>::max();
 
-    const T& getItem(uint32_t row) const { return *m_list->m_items[row]; }
+    const T& getItem(uint32_t row) const
+    {
+      if(m_probe)
+        return *m_probe;
+      return m_viewActive ? *m_view[row] : *m_list->m_items[row];
+    }
+
+    //! \brief Row count, hides \ref TableModel::rowCount so \ref getText accepts row zero while probing an item
+    uint32_t rowCount() const { return m_probe ? 1 : TableModel::rowCount(); }
+
     virtual void propertyChanged(BaseProperty& property, uint32_t row) = 0;
 
   public:
@@ -55,6 +257,30 @@ class ObjectListTableModel : public TableModel
       assert(it != m_list->m_models.end());
       m_list->m_models.erase(it);
     }
+
+    std::string getRowId(uint32_t row) const final
+    {
+      if(row < rowCount())
+        return getItem(row).getObjectId();
+      return {};
+    }
+
+    void setSortFilter(uint32_t column, bool descending, std::string_view filter) final
+    {
+      std::string filterUpper{filter};
+      toUpper(filterUpper);
+      if(column >= columnCount())
+        column = noSortColumn;
+
+      if(column == m_sortColumn && descending == m_sortDescending && filterUpper == m_filter)
+        return;
+
+      m_sortColumn = column;
+      m_sortDescending = descending;
+      m_filter = std::move(filterUpper);
+      m_viewActive = m_sortColumn != noSortColumn || !m_filter.empty();
+      rebuildView();
+    }
 };
 
 #endif
@@ -22,15 +22,23 @@
 
 #include "stateobject.hpp"
 #include "../world/world.hpp"
+#include "../world/worldjournal.hpp"
 
 void StateObject::addToWorld(World& world, StateObject& object)
 {
   world.m_objects.emplace(object.getObjectId(), object.weak_from_this());
+  object.m_world = &world;
+  if(world.m_journal)
+    world.m_journal->objectChanged(object);
 }
 
 void StateObject::removeFromWorld(World& world, StateObject& object)
 {
   world.m_objects.erase(object.m_id);
+  object.m_world = nullptr;
+  world.m_saveCache.invalidate(object);
+  if(world.m_journal)
+    world.m_journal->objectDeleted(object.m_id);
 }
 
 StateObject::StateObject(std::string id)
@@ -35,6 +35,7 @@ class StateObject : public Object
 {
 private:
   std::string m_id;
+  World* m_world = nullptr;
 
 protected:
   static void removeFromWorld(World& world, StateObject& object);
@@ -50,6 +51,12 @@ public:
   {
     return m_id;
   }
+
+  //! \brief World the object is added to, \c nullptr if not added (yet)
+  World* world() const
+  {
+    return m_world;
+  }
 };
 
 #endif
@@ -36,6 +36,7 @@ class SubObject : public Object
 
     Object& parent() const { return m_parent; }
     std::string getObjectId() const final;
+    Object* parentObject() const final { return &m_parent; }
 };
 
 #endif
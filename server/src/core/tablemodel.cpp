@@ -21,6 +21,9 @@
  */
 
 #include "tablemodel.hpp"
+#include <algorithm>
+#include <cctype>
+#include "../utils/fromchars.hpp"
 
 TableModel::TableModel() :
   m_rowCount{0}
@@ -60,22 +63,13 @@ void TableModel::setRegion(const Region& value)
 void TableModel::rowsChanged(uint32_t first, uint32_t last)
 {
   Region update = m_region;
-  if(update.rowMin <= last || update.rowMax >= first)
+  if(updateRegion && m_rowCount > 0 && update.isValid() && update.rowMin <= last && update.rowMax >= first)
   {
+    update.columnMax = std::min(update.columnMax, static_cast<uint32_t>(m_columnHeaders.size()) - 1);
     update.rowMin = std::max(update.rowMin, first);
-    update.rowMax = std::min(update.rowMax, last);
-    updateRegion(shared_ptr<TableModel>(), update);
-  }
-}
-
-void TableModel::rowRemovedHack(uint32_t row)
-{
-  //Hack, tell clients to refresh from row onwards
-  Region update = m_region;
-  if(update.rowMin <= row && update.rowMax >= row)
-  {
-    update.rowMin = row;
-    updateRegion(shared_ptr<TableModel>(), update);
+    update.rowMax = std::min({update.rowMax, last, m_rowCount - 1});
+    if(update.isValid())
+      updateRegion(shared_ptr<TableModel>(), update);
   }
 }
 
@@ -96,6 +90,103 @@ void TableModel::setRowCount(uint32_t value)
   }
 }
 
+void TableModel::insertRows(uint32_t row, uint32_t count)
+{
+  assert(row <= m_rowCount);
+  if(count == 0)
+    return;
+
+  m_rowCount += count;
+
+  if(rowsChangedIncremental)
+    rowsChangedIncremental(shared_ptr<TableModel>(), TableModelRowChange::Insert, row, count);
+  if(rowCountChanged)
+    rowCountChanged(shared_ptr<TableModel>()); // no-op for clients that applied the incremental change
+
+  // send the inserted rows and the rows shifted into the region from above:
+  const uint32_t first = std::max(row, m_region.rowMin);
+  rowsChanged(first, first + count - 1);
+}
+
+void TableModel::removeRows(uint32_t row, uint32_t count)
+{
+  assert(row + count <= m_rowCount);
+  if(count == 0)
+    return;
+
+  m_rowCount -= count;
+
+  if(rowsChangedIncremental)
+    rowsChangedIncremental(shared_ptr<TableModel>(), TableModelRowChange::Remove, row, count);
+  if(rowCountChanged)
+    rowCountChanged(shared_ptr<TableModel>()); // no-op for clients that applied the incremental change
+
+  // send the rows shifted into the region from below:
+  if(m_region.isValid() && row <= m_region.rowMax)
+  {
+    const uint32_t shifted = count > m_region.rowMax ? 0 : m_region.rowMax - count + 1;
+    rowsChanged(std::max({row, m_region.rowMin, shifted}), m_region.rowMax);
+  }
+}
+
+void TableModel::moveRow(uint32_t from, uint32_t to)
+{
+  assert(from < m_rowCount && to < m_rowCount);
+  if(from == to)
+    return;
+
+  if(rowsChangedIncremental)
+    rowsChangedIncremental(shared_ptr<TableModel>(), TableModelRowChange::Move, from, to);
+
+  // the client moves its cached rows, only rows entering the region must be sent:
+  if(from < m_region.rowMin || from > m_region.rowMax)
+    rowsChanged(to, to);
+  if(from < to && to > m_region.rowMax)
+    rowsChanged(m_region.rowMax, m_region.rowMax); // row shifted up into the region
+  else if(to < from && to < m_region.rowMin)
+    rowsChanged(m_region.rowMin, m_region.rowMin); // row shifted down into the region
+}
+
+int TableModel::compareText(std::string_view a, std::string_view b)
+{
+  int64_t numberA;
+  int64_t numberB;
+  if(!a.empty() && !b.empty() &&
+      fromChars(a, numberA).ptr == a.data() + a.size() &&
+      fromChars(b, numberB).ptr == b.data() + b.size())
+  {
+    if(numberA != numberB)
+      return numberA < numberB ? -1 : 1;
+    return 0;
+  }
+
+  const size_t n = std::min(a.size(), b.size());
+  for(size_t i = 0; i < n; i++)
+  {
+    const int ca = std::tolower(static_cast<unsigned char>(a[i]));
+    const int cb = std::tolower(static_cast<unsigned char>(b[i]));
+    if(ca != cb)
+      return ca < cb ? -1 : 1;
+  }
+  if(a.size() != b.size())
+    return a.size() < b.size() ? -1 : 1;
+  return 0;
+}
+
+int TableModel::compareSortKey(const SortKey& a, const SortKey& b)
+{
+  if(a.index() != b.index())
+    return a.index() < b.index() ? -1 : 1;
+  if(const auto* numberA = std::get_if<double>(&a))
+  {
+    const double numberB = std::get<double>(b);
+    if(*numberA != numberB)
+      return *numberA < numberB ? -1 : 1;
+    return 0;
+  }
+  return compareText(std::get<std::string>(a), std::get<std::string>(b));
+}
+
 void TableModel::changed(uint32_t row, uint32_t column)
 {
   if(updateRegion)
@@ -25,6 +25,9 @@
 
 #include "object.hpp"
 #include <functional>
+#include <limits>
+#include <variant>
+#include <traintastic/enum/tablemodelrowchange.hpp>
 #include "tablemodelptr.hpp"
 
 class TableModel : public Object
@@ -94,10 +97,28 @@ class TableModel : public Object
 
     void changed(uint32_t row, uint32_t column);
 
+    //! \brief Rows are inserted, clients only receive the inserted rows that are in their region
+    void insertRows(uint32_t row, uint32_t count);
+    //! \brief Rows are removed, clients drop them without reloading the rows below
+    void removeRows(uint32_t row, uint32_t count);
+    //! \brief Row is moved, clients move the cached row without reloading it
+    void moveRow(uint32_t from, uint32_t to);
+
+    //! \brief Compare two cell texts, numbers are compared by value, other texts case insensitive
+    static int compareText(std::string_view a, std::string_view b);
+
   public:
+    static constexpr uint32_t noSortColumn = std::numeric_limits<uint32_t>::max();
+
+    //! \brief Value a cell is sorted on, numbers are compared by value and sort before texts
+    using SortKey = std::variant<double, std::string>;
+
+    static int compareSortKey(const SortKey& a, const SortKey& b);
+
     std::function<void(const TableModelPtr&)> columnHeadersChanged;
     std::function<void(const TableModelPtr&)> rowCountChanged;
     std::function<void(const TableModelPtr&, const Region& region)> updateRegion;
+    std::function<void(const TableModelPtr&, TableModelRowChange change, uint32_t row, uint32_t value)> rowsChangedIncremental;
 
     TableModel();
 
@@ -109,10 +130,25 @@ class TableModel : public Object
 
     virtual std::string getText(uint32_t column, uint32_t row) const = 0;
 
+    //! \brief Sort key of a cell
+    //! \note Default implementation returns the text, models with numeric or translated columns
+    //!       should return a number, the server can't sort on the client's translation.
+    virtual SortKey getSortKey(uint32_t column, uint32_t row) const { return getText(column, row); }
+
+    //! \brief Id of the object shown in the row, sent with the row so clients don't depend on a column
+    //! \note Default implementation returns an empty string, for rows that aren't an object.
+    virtual std::string getRowId(uint32_t /*row*/) const { return {}; }
+
     void setRegion(const Region& value);
 
+    //! \brief Sort and/or filter the rows
+    //! \param[in] column Column to sort on, \ref noSortColumn for unsorted
+    //! \param[in] descending Sort descending instead of ascending
+    //! \param[in] filter Only show rows containing this text in one of the columns, empty for no filter
+    //! \note Default implementation ignores it, models that support it must override it.
+    virtual void setSortFilter(uint32_t /*column*/, bool /*descending*/, std::string_view /*filter*/) {}
+
     void rowsChanged(uint32_t first, uint32_t last);
-    void rowRemovedHack(uint32_t row);
 };
 
 #endif
@@ -74,6 +74,11 @@ std::string DecoderFunction::getObjectId() const
   return m_decoder.functions->getObjectId().append(".").append(m_decoder.functions->items.name()).append(".f").append(std::to_string(number.value()));
 }
 
+Object* DecoderFunction::parentObject() const
+{
+  return &m_decoder;
+}
+
 void DecoderFunction::loaded()
 {
   Object::loaded();
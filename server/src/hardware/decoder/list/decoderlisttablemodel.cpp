@@ -120,6 +120,31 @@ std::string DecoderListTableModel::getText(uint32_t column, uint32_t row) const
   return "";
 }
 
+TableModel::SortKey DecoderListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount())
+  {
+    const Decoder& decoder = getItem(row);
+
+    assert(column < m_columns.size());
+    switch(m_columns[column])
+    {
+      case DecoderListColumn::Protocol:
+        return static_cast<double>(decoder.protocol.value());
+
+      case DecoderListColumn::Address:
+        if(hasAddress(decoder.protocol.value()))
+          return static_cast<double>(decoder.address.value());
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  return getText(column, row);
+}
+
 void DecoderListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   std::string_view name = property.name();
@@ -49,6 +49,7 @@ class DecoderListTableModel : public ObjectListTableModel<Decoder>
     DecoderListTableModel(DecoderList& commandStationList);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 #endif
@@ -128,6 +128,18 @@ std::string IdentificationListTableModel::getText(uint32_t column, uint32_t row)
   return "";
 }
 
+TableModel::SortKey IdentificationListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount())
+  {
+    assert(column < m_columns.size());
+    if(m_columns[column] == IdentificationListColumn::Address)
+      return static_cast<double>(getItem(row).address.value());
+  }
+
+  return getText(column, row);
+}
+
 void IdentificationListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   std::string_view name = property.name();
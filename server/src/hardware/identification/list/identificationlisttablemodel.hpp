@@ -49,6 +49,7 @@ class IdentificationListTableModel : public ObjectListTableModel<Identification>
     IdentificationListTableModel(IdentificationList& list);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 #endif
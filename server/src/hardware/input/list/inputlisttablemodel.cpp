@@ -129,6 +129,18 @@ std::string InputListTableModel::getText(uint32_t column, uint32_t row) const
   return "";
 }
 
+TableModel::SortKey InputListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount())
+  {
+    assert(column < m_columns.size());
+    if(m_columns[column] == InputListColumn::Address)
+      return static_cast<double>(getItem(row).address.value());
+  }
+
+  return getText(column, row);
+}
+
 void InputListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   std::string_view name = property.name();
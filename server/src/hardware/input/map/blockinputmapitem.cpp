@@ -105,6 +105,11 @@ std::string BlockInputMapItem::getObjectId() const
   return m_parent.getObjectId().append(".").append(m_parent.items.name()).append(".item").append(std::to_string(m_itemId));
 }
 
+Object* BlockInputMapItem::parentObject() const
+{
+  return &m_parent;
+}
+
 void BlockInputMapItem::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state) const
 {
   InputMapItem::save(saver, data, state);
@@ -71,6 +71,7 @@ class BlockInputMapItem final : public InputMapItem
     ~BlockInputMapItem() final;
 
     std::string getObjectId() const final;
+    Object* parentObject() const final;
     uint32_t itemId() const { return m_itemId; }
     SensorState value() const { return m_value; }
 };
@@ -38,6 +38,7 @@
 #include "../../utils/inrange.hpp"
 #include "../../world/world.hpp"
 #include "../../world/worldloader.hpp"
+#include "../../world/worldjournal.hpp"
 
 constexpr auto decoderListColumns = DecoderListColumn::Id | DecoderListColumn::Name | DecoderListColumn::Protocol | DecoderListColumn::Address;
 constexpr auto inputListColumns = InputListColumn::Id | InputListColumn::Name | InputListColumn::Channel | InputListColumn::Address;
@@ -218,6 +219,8 @@ bool ECoSInterface::setOnline(bool& value, bool simulation)
 
     m_kernel->stop(simulation ? nullptr : &m_simulation);
     m_kernel.reset();
+    if(!simulation)
+      WorldJournal::changed(*this); // simulation data is updated
 
     setState(InterfaceState::Offline);
   }
@@ -74,6 +74,14 @@ std::string InterfaceListTableModel::getText(uint32_t column, uint32_t row) cons
   return "";
 }
 
+TableModel::SortKey InterfaceListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount() && column == columnStatus)
+    return static_cast<double>(getItem(row).status->state.value());
+
+  return getText(column, row);
+}
+
 void InterfaceListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   if(property.name() == "id")
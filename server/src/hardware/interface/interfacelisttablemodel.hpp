@@ -45,6 +45,7 @@ class InterfaceListTableModel : public ObjectListTableModel<Interface>
     InterfaceListTableModel(InterfaceList& interfaceList);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 #endif
@@ -49,6 +49,7 @@ class OutputListTableModel : public ObjectListTableModel<Output>
     OutputListTableModel(OutputList& list);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 #endif
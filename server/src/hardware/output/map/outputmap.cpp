@@ -48,6 +48,7 @@ OutputMap::OutputMap(Object& _parent, std::string_view parentPropertyName) :
       outputAdded(output);
       m_outputs.emplace_back(std::move(output));
       outputsChanged(*this);
+      WorldJournal::changed(*this);
     }},
   removeOutput{*this, "remove_output",
     [this](const std::shared_ptr<Output>& output)
@@ -64,6 +65,7 @@ OutputMap::OutputMap(Object& _parent, std::string_view parentPropertyName) :
         m_outputs.erase(it);
         outputRemoved(output);
         outputsChanged(*this);
+        WorldJournal::changed(*this);
       }
     }}
 {
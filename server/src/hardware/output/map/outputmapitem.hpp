@@ -48,6 +48,8 @@ class OutputMapItem : public Object
   public:
     OutputMapItem(Object& map);
 
+    Object* parentObject() const final { return &m_map; }
+
     const OutputActions& outputActions() const;
 
     void execute();
@@ -46,6 +46,7 @@ class OutputMapOutputAction : public Object
     OutputMapOutputAction(Object& _parent, std::shared_ptr<Output> _output);
 
     std::string getObjectId() const final;
+    Object* parentObject() const final { return &m_parent; }
 
     const std::shared_ptr<Output>& output() const { return m_output; }
 
@@ -26,7 +26,6 @@
 #include "../../decoder/decoderchangeflags.hpp"
 #include "../../input/inputcontroller.hpp"
 #include "../../output/outputcontroller.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../utils/rtrim.hpp"
 #include "../../../core/eventloop.hpp"
 #include "../../../log/log.hpp"
@@ -69,13 +68,7 @@ void Kernel::start()
   m_emergencyStop = TriState::Undefined;
   m_inputValues.clear();
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("dcc++");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("dcc++");
 
   m_ioContext.post(
     [this]()
@@ -101,9 +94,7 @@ void Kernel::stop()
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
 #ifndef NDEBUG
   m_started = false;
@@ -113,7 +104,7 @@ void Kernel::stop()
 void Kernel::receive(std::string_view message)
 {
   if(m_config.debugLogRXTX)
-    EventLoop::call(
+    callEventLoop(
       [this, msg=std::string(rtrim(message, '\n'))]()
       {
         Log::log(logId, LogMessage::D2002_RX_X, msg);
@@ -138,7 +129,7 @@ void Kernel::receive(std::string_view message)
 
           if(value != TriState::Undefined)
           {
-            EventLoop::call(
+            callEventLoop(
               [this, id, value]()
               {
                 m_outputController->updateOutputValue(OutputChannel::turnout, id, value);
@@ -155,7 +146,7 @@ void Kernel::receive(std::string_view message)
             m_powerOn = TriState::False;
 
             if(m_onPowerOnChanged)
-              EventLoop::call(
+              callEventLoop(
                 [this]()
                 {
                   m_onPowerOnChanged(false);
@@ -169,7 +160,7 @@ void Kernel::receive(std::string_view message)
             m_powerOn = TriState::True;
 
             if(m_onPowerOnChanged)
-              EventLoop::call(
+              callEventLoop(
                 [this]()
                 {
                   m_onPowerOnChanged(true);
@@ -191,7 +182,7 @@ void Kernel::receive(std::string_view message)
             {
               m_inputValues[id] = value;
 
-              EventLoop::call(
+              callEventLoop(
                 [this, id, value]()
                 {
                   m_inputController->updateInputValue(InputController::defaultInputChannel, id, toTriState(value));
@@ -216,7 +207,7 @@ void Kernel::receive(std::string_view message)
 
           if(value != TriState::Undefined)
           {
-            EventLoop::call(
+            callEventLoop(
               [this, id, value]()
               {
                 m_outputController->updateOutputValue(OutputChannel::output, id, value);
@@ -304,7 +295,7 @@ bool Kernel::setOutput(uint32_t channel, uint16_t address, bool value)
           send(Ex::setAccessory(address, value));
 
           // no response for accessory command, assume it succeeds:
-          EventLoop::call(
+          callEventLoop(
             [this, address, value]()
             {
               m_outputController->updateOutputValue(OutputChannel::dccAccessory, address, toTriState(value));
@@ -381,7 +372,7 @@ void Kernel::send(std::string_view message)
   if(m_ioHandler->send(message))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [this, msg=std::string(rtrim(message, '\n'))]()
         {
           Log::log(logId, LogMessage::D2001_TX_X, msg);
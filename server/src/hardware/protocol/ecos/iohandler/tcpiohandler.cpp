@@ -95,7 +95,7 @@ void TCPIOHandler::read()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2008_SOCKET_READ_FAILED_X, ec);
@@ -206,7 +206,7 @@ void TCPIOHandler::write()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2007_SOCKET_WRITE_FAILED_X, ec);
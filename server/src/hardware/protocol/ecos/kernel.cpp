@@ -35,7 +35,6 @@
 #include "../../decoder/decoderchangeflags.hpp"
 #include "../../input/inputcontroller.hpp"
 #include "../../output/outputcontroller.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../utils/startswith.hpp"
 #include "../../../utils/ltrim.hpp"
 #include "../../../utils/rtrim.hpp"
@@ -44,7 +43,7 @@
 #include "../../../log/log.hpp"
 #include "../../../log/logmessageexception.hpp"
 
-#define ASSERT_IS_KERNEL_THREAD assert(std::this_thread::get_id() == m_thread.get_id())
+#define ASSERT_IS_KERNEL_THREAD assert(isKernelThread())
 
 namespace ECoS {
 
@@ -127,13 +126,7 @@ void Kernel::start()
   assert(!m_started);
   assert(m_objects.empty());
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("ecos");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("ecos");
 
   m_ioContext.post(
     [this]()
@@ -144,7 +137,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -174,9 +167,7 @@ void Kernel::stop(Simulation* simulation)
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
   if(simulation) // get simulation data
   {
@@ -217,7 +208,7 @@ void Kernel::receive(std::string_view message)
   {
     std::string msg{rtrim(message, {'\r', '\n'})};
     std::replace_if(msg.begin(), msg.end(), [](char c){ return c == '\r' || c == '\n'; }, ';');
-    EventLoop::call([this, msg](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
+    callEventLoop([this, msg](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
   }
 
   if(Reply reply; parseReply(message, reply))
@@ -233,7 +224,7 @@ void Kernel::receive(std::string_view message)
       it->second->receiveEvent(event);
   }
   else
-  {}//  EventLoop::call([this]() { Log::log(logId, LogMessage::E2018_ParseError); });
+  {}//  callEventLoop([this]() { Log::log(logId, LogMessage::E2018_ParseError); });
 }
 
 ECoS& Kernel::ecos()
@@ -248,9 +239,9 @@ void Kernel::ecosGoChanged(TriState value)
   ASSERT_IS_KERNEL_THREAD;
 
   if(value == TriState::False && m_onEmergencyStop)
-    EventLoop::call([this]() { m_onEmergencyStop(); });
+    callEventLoop([this]() { m_onEmergencyStop(); });
   else if(value == TriState::True && m_onGo)
-    EventLoop::call([this]() { m_onGo(); });
+    callEventLoop([this]() { m_onGo(); });
 }
 
 Locomotive* Kernel::getLocomotive(DecoderProtocol protocol, uint16_t address, uint8_t speedSteps)
@@ -452,7 +443,7 @@ void Kernel::switchManagerSwitched(SwitchProtocol protocol, uint16_t address)
   switch(protocol)
   {
     case SwitchProtocol::DCC:
-      EventLoop::call(
+      callEventLoop(
         [this, address]()
         {
           m_outputController->updateOutputValue(OutputChannel::dcc, address, TriState::True);
@@ -461,7 +452,7 @@ void Kernel::switchManagerSwitched(SwitchProtocol protocol, uint16_t address)
       break;
 
     case SwitchProtocol::Motorola:
-      EventLoop::call(
+      callEventLoop(
         [this, address]()
         {
           m_outputController->updateOutputValue(OutputChannel::motorola, address, TriState::True);
@@ -502,7 +493,7 @@ void Kernel::feedbackStateChanged(Feedback& object, uint8_t port, TriState value
       offset += feedback->ports();
     }
 
-    EventLoop::call(
+    callEventLoop(
       [this, address=offset + port, value]()
       {
         m_inputController->updateInputValue(InputChannel::s88, address, value);
@@ -513,7 +504,7 @@ void Kernel::feedbackStateChanged(Feedback& object, uint8_t port, TriState value
     const uint16_t portsPerObject = 16;
     const uint16_t address = 1 + port + portsPerObject * (object.id() - ObjectId::ecosDetector);
 
-    EventLoop::call(
+    callEventLoop(
       [this, address, value]()
       {
         m_inputController->updateInputValue(InputChannel::ecosDetector, address, value);
@@ -533,7 +524,7 @@ void Kernel::send(std::string_view message)
   if(m_ioHandler->send(message))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [this, msg=std::string(rtrim(message, '\n'))]()
         {
           Log::log(logId, LogMessage::D2001_TX_X, msg);
@@ -21,14 +21,78 @@
  */
 
 #include "kernelbase.hpp"
+#include <future>
 #include "../../core/eventloop.hpp"
+#include "../../utils/setthreadname.hpp"
 
 KernelBase::KernelBase(std::string logId_)
-  : m_ioContext{1}
+  : m_threadPool{KernelThreadPool::config.enabled ? KernelThreadPool::get() : nullptr}
+  , m_threadPoolWorker{m_threadPool ? &m_threadPool->acquire() : nullptr}
+  , m_ownIOContext{m_threadPool ? nullptr : std::make_unique<boost::asio::io_context>(1)}
+  , m_ioContext{m_threadPoolWorker ? m_threadPoolWorker->ioContext : *m_ownIOContext}
   , logId{logId_}
 {
 }
 
+KernelBase::~KernelBase()
+{
+  assert(!m_thread.joinable());
+  if(m_threadPoolWorker)
+  {
+    // IO objects of the kernel are destroyed by now, their aborted operations complete on the shared IO context:
+    drainIOContext();
+    m_threadPool->release(*m_threadPoolWorker);
+  }
+}
+
+void KernelBase::startIOContext(const char* threadName)
+{
+  assert(isEventLoopThread());
+
+  if(!m_ownIOContext)
+    return;
+
+  m_thread = std::thread(
+    [this, threadName]()
+    {
+      setThreadName(threadName);
+      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
+      m_ioContext.run();
+    });
+}
+
+void KernelBase::stopIOContext()
+{
+  assert(isEventLoopThread());
+
+  if(m_ownIOContext && !m_thread.joinable()) // not started
+    return;
+
+  drainIOContext();
+
+  if(m_ownIOContext)
+  {
+    m_ioContext.stop();
+    m_thread.join();
+  }
+}
+
+void KernelBase::drainIOContext()
+{
+  // Posting twice puts the barrier behind the completion handlers of operations cancelled by already posted handlers:
+  std::promise<void> done;
+  m_ioContext.post(
+    [this, &done]()
+    {
+      m_ioContext.post(
+        [&done]()
+        {
+          done.set_value();
+        });
+    });
+  done.get_future().wait();
+}
+
 void KernelBase::setOnStarted(std::function<void()> callback)
 {
   assert(isEventLoopThread());
@@ -54,7 +118,7 @@ void KernelBase::error()
   }
   else
   {
-    EventLoop::call(
+    callEventLoop(
       [this]()
       {
         m_onError();
@@ -73,7 +137,7 @@ void KernelBase::started()
   }
   else
   {
-    EventLoop::call(
+    callEventLoop(
       [this]()
       {
         m_onStarted();
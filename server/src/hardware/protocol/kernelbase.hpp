@@ -27,22 +27,58 @@
 #include <functional>
 #include <thread>
 #include <boost/asio/io_context.hpp>
+#include "kernelthreadpool.hpp"
+#include "../../core/eventloopqueue.hpp"
 
 class KernelBase
 {
   private:
     std::function<void()> m_onStarted;
     std::function<void()> m_onError;
+    std::shared_ptr<KernelThreadPool> m_threadPool; //!< only set if the kernel runs on the kernel thread pool
+    KernelThreadPool::Worker* m_threadPoolWorker;
+    std::unique_ptr<boost::asio::io_context> m_ownIOContext; //!< only set if the kernel runs in its own thread
+    std::thread m_thread;
+
+    //! \brief Wait until all handlers posted before this call and the completion handlers of operations cancelled by them are executed
+    void drainIOContext();
 
   protected:
-    boost::asio::io_context m_ioContext;
-    std::thread m_thread;
+    boost::asio::io_context& m_ioContext;
+    EventLoopQueue m_eventLoopQueue;
 
 #ifndef NDEBUG
     bool m_started = false;
 #endif
 
     KernelBase(std::string logId_);
+    ~KernelBase();
+
+    /**
+     * \brief Start running the IO context
+     *
+     * Starts the kernel thread, or if the kernel runs on the kernel thread pool, does nothing as the pool thread is already running.
+     *
+     * \param[in] threadName Name of the kernel thread.
+     * \note This function must run in the event loop thread.
+     */
+    void startIOContext(const char* threadName);
+
+    /**
+     * \brief Stop running the IO context
+     *
+     * Waits until all handlers posted before this call are executed, including the completion handlers of
+     * operations cancelled by them. If the kernel runs in its own thread the thread is stopped.
+     * The event loop is blocked while waiting, on the kernel thread pool this includes handlers of other
+     * kernels queued on the same worker.
+     *
+     * Handlers that complete after this call, e.g. operations cancelled when their IO object is destroyed,
+     * may only check the error code. Without the pool they are never called, on the pool they are called
+     * with \c operation_aborted before the kernel is released, see \ref KernelThreadPool.
+     *
+     * \note This function must run in the event loop thread.
+     */
+    void stopIOContext();
 
     void started();
 
@@ -59,6 +95,32 @@ class KernelBase
       return m_ioContext;
     }
 
+    /**
+     * \brief Check if the caller runs in the kernel thread
+     *
+     * If the kernel runs on the kernel thread pool this checks for the pool thread running the kernel's IO context,
+     * which serializes the kernel's handlers like a strand.
+     */
+    bool isKernelThread() const
+    {
+      return std::this_thread::get_id() == (m_threadPoolWorker ? m_threadPoolWorker->thread.get_id() : m_thread.get_id());
+    }
+
+    /**
+     * \brief Call function in the event loop thread
+     *
+     * Calls are queued per kernel and executed in order, the event loop drains the queue in batches.
+     * Calls that are still queued when the kernel is destroyed are discarded.
+     *
+     * \param[in] f Function to call.
+     * \note This function is thread safe.
+     */
+    template<typename Func>
+    void callEventLoop(Func&& f)
+    {
+      m_eventLoopQueue.call(std::forward<Func>(f));
+    }
+
     /**
      * \brief ...
      *
@@ -0,0 +1,100 @@
+/**
+ * server/src/hardware/protocol/kernelthreadpool.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "kernelthreadpool.hpp"
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include "../../core/eventloop.hpp"
+#include "../../log/log.hpp"
+#include "../../utils/setthreadaffinity.hpp"
+#include "../../utils/setthreadname.hpp"
+
+std::shared_ptr<KernelThreadPool> KernelThreadPool::get()
+{
+  assert(isEventLoopThread());
+
+  auto pool = s_instance.lock();
+  if(!pool)
+  {
+    pool = std::make_shared<KernelThreadPool>(config.threadCount, config.pinThreads);
+    s_instance = pool;
+  }
+  return pool;
+}
+
+KernelThreadPool::KernelThreadPool(uint32_t threadCount, bool pinThreads)
+{
+  threadCount = std::clamp<uint32_t>(threadCount, 1, threadCountMax);
+  const unsigned int cpuCount = std::max(1U, std::thread::hardware_concurrency());
+
+  m_workers.reserve(threadCount);
+  for(uint32_t i = 0; i < threadCount; i++)
+  {
+    auto& worker = *m_workers.emplace_back(std::make_unique<Worker>());
+    worker.thread = std::thread(
+      [&worker, index=i, cpu=(pinThreads ? static_cast<int>(i % cpuCount) : -1)]()
+      {
+        setThreadName(("kernel_" + std::to_string(index)).c_str());
+        if(cpu >= 0 && !setThreadAffinity(static_cast<unsigned int>(cpu)))
+        {
+          EventLoop::call(
+            [index, cpu]()
+            {
+              Log::log(logId, LogMessage::W2008_PINNING_KERNEL_THREAD_X_TO_CPU_X_FAILED, index, cpu);
+            });
+        }
+        auto work = std::make_shared<boost::asio::io_context::work>(worker.ioContext);
+        worker.ioContext.run();
+      });
+  }
+}
+
+KernelThreadPool::~KernelThreadPool()
+{
+  for(auto& worker : m_workers)
+  {
+    assert(worker->kernelCount == 0);
+    worker->ioContext.stop();
+    worker->thread.join();
+  }
+}
+
+KernelThreadPool::Worker& KernelThreadPool::acquire()
+{
+  assert(isEventLoopThread());
+
+  auto& worker = **std::min_element(m_workers.begin(), m_workers.end(),
+    [](const auto& a, const auto& b)
+    {
+      return a->kernelCount < b->kernelCount;
+    });
+  worker.kernelCount++;
+  return worker;
+}
+
+void KernelThreadPool::release(Worker& worker)
+{
+  assert(isEventLoopThread());
+  assert(worker.kernelCount > 0);
+  worker.kernelCount--;
+}
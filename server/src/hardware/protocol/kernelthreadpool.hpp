@@ -0,0 +1,107 @@
+/**
+ * server/src/hardware/protocol/kernelthreadpool.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELTHREADPOOL_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELTHREADPOOL_HPP
+
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+
+struct KernelThreadPoolConfig
+{
+  bool enabled = false;
+  uint32_t threadCount = 2;
+  bool pinThreads = false;
+};
+
+/**
+ * \brief Shared IO threads for hardware kernels
+ *
+ * By default every kernel runs its own IO context in its own thread. When enabled, kernels share a
+ * small pool of IO contexts instead. Each IO context is run by a single thread, optionally pinned
+ * to a CPU, and acts as the strand for all kernels assigned to it. A kernel stays assigned to the
+ * same IO context for its lifetime, so its handlers are serialized just like with a dedicated thread.
+ *
+ * \note The pool is experimental and disabled by default. A shared IO context keeps running after a
+ *       kernel is stopped, so completion handlers of IO objects the kernel didn't cancel in its stop
+ *       handler run while the kernel is being destroyed. The kernel waits for them before it is
+ *       released, but such handlers may only check for \c operation_aborted, handlers don't hold a
+ *       reference to their kernel.
+ */
+class KernelThreadPool
+{
+  public:
+    struct Worker
+    {
+      boost::asio::io_context ioContext{1};
+      std::thread thread;
+      uint32_t kernelCount = 0;
+    };
+
+    static constexpr std::string_view logId{"kernel_thread_pool"};
+    static constexpr uint32_t threadCountMax = 64;
+
+    //! Pool configuration, applied when the pool is created.
+    //! \note May only be accessed by the event loop thread.
+    inline static KernelThreadPoolConfig config;
+
+  private:
+    inline static std::weak_ptr<KernelThreadPool> s_instance;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+  public:
+    /**
+     * \brief Get the kernel thread pool
+     *
+     * The pool is created using the current \ref config if it doesn't exist yet,
+     * it is destroyed when it is no longer referenced.
+     *
+     * \note This function must run in the event loop thread.
+     */
+    static std::shared_ptr<KernelThreadPool> get();
+
+    KernelThreadPool(uint32_t threadCount, bool pinThreads);
+    ~KernelThreadPool();
+
+    KernelThreadPool(const KernelThreadPool&) = delete;
+    KernelThreadPool& operator =(const KernelThreadPool&) = delete;
+
+    inline size_t threadCount() const { return m_workers.size(); }
+
+    /**
+     * \brief Assign a kernel to the least used worker
+     * \note This function must run in the event loop thread.
+     */
+    Worker& acquire();
+
+    /**
+     * \brief Release a worker acquired using \ref acquire
+     * \note This function must run in the event loop thread.
+     */
+    void release(Worker& worker);
+};
+
+#endif
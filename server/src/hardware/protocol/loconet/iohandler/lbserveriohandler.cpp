@@ -157,7 +157,7 @@ void LBServerIOHandler::read()
       }
       else
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2008_SOCKET_READ_FAILED_X, ec);
@@ -176,7 +176,7 @@ void LBServerIOHandler::write()
     {
       if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2007_SOCKET_WRITE_FAILED_X, ec);
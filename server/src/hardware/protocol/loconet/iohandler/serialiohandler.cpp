@@ -94,7 +94,7 @@ void SerialIOHandler::read()
 
           if(drop != 0)
           {
-            EventLoop::call(
+            m_kernel.callEventLoop(
               [this, drop]()
               {
                 Log::log(m_kernel.logId, LogMessage::W2001_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES, drop);
@@ -118,7 +118,7 @@ void SerialIOHandler::read()
       }
       else
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2002_SERIAL_READ_FAILED_X, ec);
@@ -146,7 +146,7 @@ void SerialIOHandler::write()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2001_SERIAL_WRITE_FAILED_X, ec);
@@ -87,7 +87,7 @@ void TCPBinaryIOHandler::read()
 
           if(drop != 0)
           {
-            EventLoop::call(
+            m_kernel.callEventLoop(
               [this, drop]()
               {
                 Log::log(m_kernel.logId, LogMessage::W2001_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES, drop);
@@ -111,7 +111,7 @@ void TCPBinaryIOHandler::read()
       }
       else
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2008_SOCKET_READ_FAILED_X, ec);
@@ -139,7 +139,7 @@ void TCPBinaryIOHandler::write()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2007_SOCKET_WRITE_FAILED_X, ec);
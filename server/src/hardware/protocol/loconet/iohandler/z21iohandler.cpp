@@ -140,7 +140,7 @@ void Z21IOHandler::receive()
       }
       else
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2009_SOCKET_RECEIVE_FAILED_X, ec);
@@ -177,7 +177,7 @@ void Z21IOHandler::send()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2011_SOCKET_SEND_FAILED_X, ec);
@@ -30,7 +30,6 @@
 #include "../../output/outputcontroller.hpp"
 #include "../../identification/identificationcontroller.hpp"
 #include "../../../utils/datetimestr.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../utils/inrange.hpp"
 #include "../../../pcap/pcapfile.hpp"
 #include "../../../pcap/pcappipe.hpp"
@@ -121,7 +120,7 @@ void Kernel::setConfig(const Config& config)
         for(auto& queue : m_sendQueue)
           queue.clear();
 
-        EventLoop::call(
+        callEventLoop(
           [this]()
           {
             Log::log(logId, LogMessage::N2006_LISTEN_ONLY_MODE_ACTIVATED);
@@ -129,7 +128,7 @@ void Kernel::setConfig(const Config& config)
       }
       else if(!newConfig.listenOnly && m_config.listenOnly)
       {
-        EventLoop::call(
+        callEventLoop(
           [this]()
           {
             Log::log(logId, LogMessage::N2007_LISTEN_ONLY_MODE_DEACTIVATED);
@@ -227,13 +226,7 @@ void Kernel::start()
   if(m_config.listenOnly)
     Log::log(logId, LogMessage::N2006_LISTEN_ONLY_MODE_ACTIVATED);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("loconet");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("loconet");
 
   if(m_config.fastClock == LocoNetFastClock::Master)
     enableClockEvents();
@@ -250,7 +243,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -292,9 +285,7 @@ void Kernel::stop()
       m_pcap.reset();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
 #ifndef NDEBUG
   m_started = false;
@@ -310,7 +301,7 @@ void Kernel::receive(const Message& message)
     m_pcap->writeRecord(&message, message.size());
 
   if(m_config.debugLogRXTX)
-    EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
+    callEventLoop([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
 
   bool isResponse = false;
   if(m_waitingForEcho && message == lastSentMessage())
@@ -335,7 +326,7 @@ void Kernel::receive(const Message& message)
       {
         m_globalPower = TriState::True;
         if(m_onGlobalPowerChanged)
-          EventLoop::call(
+          callEventLoop(
             [this]()
             {
               m_onGlobalPowerChanged(true);
@@ -348,7 +339,7 @@ void Kernel::receive(const Message& message)
       {
         m_globalPower = TriState::False;
         if(m_onGlobalPowerChanged)
-          EventLoop::call(
+          callEventLoop(
             [this]()
             {
               m_onGlobalPowerChanged(false);
@@ -361,7 +352,7 @@ void Kernel::receive(const Message& message)
       {
         m_emergencyStop = TriState::True;
         if(m_onIdle)
-          EventLoop::call(
+          callEventLoop(
             [this]()
             {
               m_onIdle();
@@ -383,7 +374,7 @@ void Kernel::receive(const Message& message)
           {
             slot->speed = locoSpd.speed;
 
-            EventLoop::call(
+            callEventLoop(
               [this, address=slot->address, speed=slot->speed]()
               {
                 if(auto decoder = getDecoder(address))
@@ -410,7 +401,7 @@ void Kernel::receive(const Message& message)
             {
               slot->direction = locoDirF.direction();
 
-              EventLoop::call(
+              callEventLoop(
                 [this, address=slot->address, direction=locoDirF.direction()]()
                 {
                   if(auto decoder = getDecoder(address))
@@ -467,7 +458,7 @@ void Kernel::receive(const Message& message)
           if(m_inputValues[inputRep.fullAddress()] != value)
           {
             if(m_config.debugLogInput)
-              EventLoop::call(
+              callEventLoop(
                 [this, address=1 + inputRep.fullAddress(), value=inputRep.value()]()
                 {
                   Log::log(logId, LogMessage::D2007_INPUT_X_IS_X, address, value ? std::string_view{"1"} : std::string_view{"0"});
@@ -475,7 +466,7 @@ void Kernel::receive(const Message& message)
 
             m_inputValues[inputRep.fullAddress()] = value;
 
-            EventLoop::call(
+            callEventLoop(
               [this, address=1 + inputRep.fullAddress(), value]()
               {
                 m_inputController->updateInputValue(InputController::defaultInputChannel, address, value);
@@ -493,7 +484,7 @@ void Kernel::receive(const Message& message)
         if(m_outputValues[switchRequest.fullAddress()] != on)
         {
           if(m_config.debugLogOutput)
-            EventLoop::call(
+            callEventLoop(
               [this, address=1 + switchRequest.fullAddress(), on=switchRequest.on()]()
               {
                 Log::log(logId, LogMessage::D2008_OUTPUT_X_IS_X, address, on ? std::string_view{"1"} : std::string_view{"0"});
@@ -501,7 +492,7 @@ void Kernel::receive(const Message& message)
 
           m_outputValues[switchRequest.fullAddress()] = on;
 
-          EventLoop::call(
+          callEventLoop(
             [this, address=1 + switchRequest.fullAddress(), on]()
             {
               m_outputController->updateOutputValue(OutputController::defaultOutputChannel, address, on);
@@ -542,7 +533,7 @@ void Kernel::receive(const Message& message)
 
         if(changed)
         {
-          EventLoop::call(
+          callEventLoop(
             [this, address=locoSlot->address, speed=locoSlot->speed, direction=locoSlot->direction]()
             {
               if(auto decoder = getDecoder(address))
@@ -590,7 +581,7 @@ void Kernel::receive(const Message& message)
       const auto& longAck = static_cast<const LongAck&>(message);
       if(longAck.respondingOpCode() == OPC_LOCO_ADR && longAck.ack1 == 0)
       {
-        EventLoop::call(
+        callEventLoop(
           [this]()
           {
             Log::log(logId, LogMessage::C2004_CANT_GET_FREE_SLOT);
@@ -602,7 +593,7 @@ void Kernel::receive(const Message& message)
 
         if(isLocoSlot(slot))
         {
-          EventLoop::call(
+          callEventLoop(
             [this, slot]()
             {
               Log::log(logId, LogMessage::W2006_COMMAND_STATION_DOES_NOT_SUPPORT_LOCO_SLOT_X, slot);
@@ -614,7 +605,7 @@ void Kernel::receive(const Message& message)
           if(m_config.fastClockSyncEnabled)
             stopFastClockSyncTimer();
 
-          EventLoop::call(
+          callEventLoop(
             [this, stoppedFastClockSyncTimer=m_config.fastClockSyncEnabled]()
             {
               Log::log(logId, LogMessage::W2007_COMMAND_STATION_DOES_NOT_SUPPORT_THE_FAST_CLOCK_SLOT);
@@ -633,7 +624,7 @@ void Kernel::receive(const Message& message)
           m_lncvModuleAddress = lncvWrite.value();
         }
 
-        EventLoop::call(
+        callEventLoop(
           [this, lncvWrite]()
           {
             m_onLNCVReadResponse(true, lncvWrite.lncv(), lncvWrite.value());
@@ -673,7 +664,7 @@ void Kernel::receive(const Message& message)
       const auto& multiSense = static_cast<const MultiSense&>(message);
       if(multiSense.isTransponder())
       {
-        EventLoop::call(
+        callEventLoop(
           [this, multiSenseTransponder=static_cast<const MultiSenseTransponder&>(multiSense)]()
           {
             m_identificationController->identificationEvent(
@@ -729,7 +720,7 @@ void Kernel::receive(const Message& message)
                   slot->functions[20] = toTriState(locoF12F20F28.f20());
                   slot->functions[28] = toTriState(locoF12F20F28.f28());
 
-                  EventLoop::call(
+                  callEventLoop(
                     [this, address=slot->address, f12=locoF12F20F28.f12(), f20=locoF12F20F28.f20(), f28=locoF12F20F28.f28()]()
                     {
                       if(auto decoder = getDecoder(address))
@@ -766,7 +757,7 @@ void Kernel::receive(const Message& message)
       const MultiSenseLong& multiSense = static_cast<const MultiSenseLong&>(message);
       if(multiSense.code() == MultiSenseLong::Code::ReleaseTransponder || multiSense.code() == MultiSenseLong::Code::DetectTransponder)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, multiSense]()
           {
             m_identificationController->identificationEvent(
@@ -783,7 +774,7 @@ void Kernel::receive(const Message& message)
     case OPC_E4:
       if(static_cast<const Uhlenbrock::Lissy&>(message).type() == Uhlenbrock::Lissy::Type::AddressCategoryDirection)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, lissy=static_cast<const Uhlenbrock::LissyAddressCategoryDirection&>(message)]()
           {
             m_identificationController->identificationEvent(
@@ -813,7 +804,7 @@ void Kernel::receive(const Message& message)
             m_lncvModuleAddress = lncvReadResponse.value();
           }
 
-          EventLoop::call(
+          callEventLoop(
             [this, lncvReadResponse]()
             {
               m_onLNCVReadResponse(true, lncvReadResponse.lncv(), lncvReadResponse.value());
@@ -1372,7 +1363,7 @@ void Kernel::sendNextMessage()
       const Message& message = m_sendQueue[priority].front();
 
       if(m_config.debugLogRXTX)
-        EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2001_TX_X, msg); });
+        callEventLoop([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2001_TX_X, msg); });
 
       if(m_ioHandler->send(message))
       {
@@ -1403,7 +1394,7 @@ void Kernel::waitingForEchoTimerExpired(const boost::system::error_code& ec)
   if(ec)
     return;
 
-  EventLoop::call(
+  callEventLoop(
     [this]()
     {
       Log::log(logId, LogMessage::W2018_TIMEOUT_NO_ECHO_WITHIN_X_MS, m_config.echoTimeout);
@@ -1419,7 +1410,7 @@ void Kernel::waitingForResponseTimerExpired(const boost::system::error_code& ec)
 
   if(m_lncvActive && Uhlenbrock::LNCVStart::check(lastSentMessage()))
   {
-    EventLoop::call(
+    callEventLoop(
       [this, lncvStart=static_cast<const Uhlenbrock::LNCVStart&>(lastSentMessage())]()
       {
         Log::log(logId, LogMessage::N2002_NO_RESPONSE_FROM_LNCV_MODULE_X_WITH_ADDRESS_X, lncvStart.moduleId(), lncvStart.address());
@@ -1432,7 +1423,7 @@ void Kernel::waitingForResponseTimerExpired(const boost::system::error_code& ec)
   }
   else
   {
-    EventLoop::call(
+    callEventLoop(
       [this]()
       {
         Log::log(logId, LogMessage::E2019_TIMEOUT_NO_RESPONSE_WITHIN_X_MS, m_config.responseTimeout);
@@ -1526,7 +1517,7 @@ bool Kernel::updateFunctions(LocoSlot& slot, const T& message)
     }
   }
 
-  EventLoop::call(
+  callEventLoop(
     [this, address=slot.address, message]()
     {
       if(auto decoder = getDecoder(address))
@@ -1551,7 +1542,7 @@ void Kernel::startPCAP(PCAPOutput pcapOutput)
       case PCAPOutput::File:
       {
         const auto filename = m_debugDir / logId += dateTimeStr() += ".pcap";
-        EventLoop::call(
+        callEventLoop(
           [this, filename]()
           {
             Log::log(logId, LogMessage::N2004_STARTING_PCAP_FILE_LOG_X, filename);
@@ -1567,7 +1558,7 @@ void Kernel::startPCAP(PCAPOutput pcapOutput)
 #else // unix
         pipe = std::filesystem::temp_directory_path() / "traintastic-server" / logId;
 #endif
-        EventLoop::call(
+        callEventLoop(
           [this, pipe]()
           {
             Log::log(logId, LogMessage::N2005_STARTING_PCAP_LOG_PIPE_X, pipe);
@@ -1579,7 +1570,7 @@ void Kernel::startPCAP(PCAPOutput pcapOutput)
   }
   catch(const std::exception& e)
   {
-    EventLoop::call(
+    callEventLoop(
       [this, what=std::string(e.what())]()
       {
         Log::log(logId, LogMessage::E2021_STARTING_PCAP_LOG_FAILED_X, what);
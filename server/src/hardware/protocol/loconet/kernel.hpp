@@ -264,13 +264,6 @@ class Kernel : public ::KernelBase
     Kernel& operator =(const Kernel&) = delete;
     ~Kernel();
 
-#ifndef NDEBUG
-    bool isKernelThread() const
-    {
-      return std::this_thread::get_id() == m_thread.get_id();
-    }
-#endif
-
     /**
      * @brief Create kernel and IO handler
      *
@@ -69,7 +69,7 @@ void SerialIOHandler::read()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2002_SERIAL_READ_FAILED_X, ec);
@@ -97,7 +97,7 @@ void SerialIOHandler::write()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2001_SERIAL_WRITE_FAILED_X, ec);
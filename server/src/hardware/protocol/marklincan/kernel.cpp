@@ -39,7 +39,6 @@
 #include "../../../log/logmessageexception.hpp"
 #include "../../../traintastic/traintastic.hpp"
 #include "../../../utils/inrange.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../utils/tohex.hpp"
 #include "../../../utils/writefile.hpp"
 #include "../../../utils/zlib.hpp"
@@ -136,13 +135,7 @@ void Kernel::start()
   m_outputValuesDCC.fill(TriState::Undefined);
   m_outputValuesSX1.fill(TriState::Undefined);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("marklin_can");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("marklin_can");
 
   m_ioContext.post(
     [this]()
@@ -153,7 +146,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -193,12 +186,11 @@ void Kernel::stop()
   m_ioContext.post(
     [this]()
     {
+      m_statusDataConfigRequestTimer.cancel();
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
 #ifndef NDEBUG
   m_started = false;
@@ -210,7 +202,7 @@ void Kernel::receive(const Message& message)
   assert(isKernelThread());
 
   if(m_config.debugLogRXTX)
-    EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
+    callEventLoop([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
 
   switch(message.command())
   {
@@ -232,7 +224,7 @@ void Kernel::receive(const Message& message)
             auto [success, protocol, address] = uidToProtocolAddress(system.uid());
             if(success)
             {
-              EventLoop::call(
+              callEventLoop(
                 [this, protocol=protocol, address=address]()
                 {
                   if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
@@ -274,7 +266,7 @@ void Kernel::receive(const Message& message)
           auto [success, protocol, address] = uidToProtocolAddress(locomotiveSpeed.uid());
           if(success)
           {
-            EventLoop::call(
+            callEventLoop(
               [this, protocol=protocol, address=address, throttle=Decoder::speedStepToThrottle(locomotiveSpeed.speed(), LocomotiveSpeed::speedMax)]()
               {
                 if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
@@ -313,7 +305,7 @@ void Kernel::receive(const Message& message)
                 break;
             }
 
-            EventLoop::call(
+            callEventLoop(
               [this, protocol=protocol, address=address, direction]()
               {
                 if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
@@ -333,7 +325,7 @@ void Kernel::receive(const Message& message)
           auto [success, protocol, address] = uidToProtocolAddress(locomotiveFunction.uid());
           if(success)
           {
-            EventLoop::call(
+            callEventLoop(
               [this, protocol=protocol, address=address, number=locomotiveFunction.number(), value=locomotiveFunction.isOn()]()
               {
                 if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
@@ -388,7 +380,7 @@ void Kernel::receive(const Message& message)
 
         if(channel != 0)
         {
-          EventLoop::call(
+          callEventLoop(
             [this, channel, address, value]()
             {
               m_outputController->updateOutputValue(channel, address, value);
@@ -416,7 +408,7 @@ void Kernel::receive(const Message& message)
             {
               m_inputValues[feedbackState.contactId() - s88AddressMin] = value;
 
-              EventLoop::call(
+              callEventLoop(
                 [this, address=feedbackState.contactId(), value]()
                 {
                   m_inputController->updateInputValue(InputController::defaultInputChannel, address, value);
@@ -715,7 +707,7 @@ void Kernel::send(const Message& message)
   assert(isKernelThread());
 
   if(m_config.debugLogRXTX)
-    EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2001_TX_X, msg); });
+    callEventLoop([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2001_TX_X, msg); });
 
   m_ioHandler->send(message);
 }
@@ -795,7 +787,7 @@ void Kernel::receiveConfigData(std::unique_ptr<ConfigDataStreamCollector> config
         writeFile(std::filesystem::path(basename).concat(".txt"), locList);
       }
 
-      EventLoop::call(
+      callEventLoop(
         [this, list=std::make_shared<LocomotiveList>(locList)]()
         {
           // update MFX UID to SID list:
@@ -863,7 +855,7 @@ void Kernel::nodeChanged(const Node& node)
   assert(isKernelThread());
 
   if(m_onNodeChanged) /*[[likely]]*/
-    EventLoop::call(
+    callEventLoop(
       [this, node=node]()
       {
         static_assert(!std::is_reference_v<decltype(node)>);
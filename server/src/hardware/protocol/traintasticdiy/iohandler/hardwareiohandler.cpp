@@ -75,7 +75,7 @@ void HardwareIOHandler::processRead(size_t bytesTransferred)
 
     if(drop != 0)
     {
-      EventLoop::call(
+      m_kernel.callEventLoop(
         [this, drop, bytes=toHex(pos - drop, drop, true)]()
         {
           Log::log(m_kernel.logId, LogMessage::W2003_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES_X, drop, bytes);
@@ -28,7 +28,6 @@
 #include "../../input/inputcontroller.hpp"
 #include "../../output/outputcontroller.hpp"
 #include "../../../utils/inrange.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../core/eventloop.hpp"
 #include "../../../core/objectproperty.tpp"
 #include "../../../log/log.hpp"
@@ -107,13 +106,7 @@ void Kernel::start()
   m_featureFlags3 = FeatureFlags3::None;
   m_featureFlags4 = FeatureFlags4::None;
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("traintasticdiy");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("traintasticdiy");
 
   m_ioContext.post(
     [this]()
@@ -124,7 +117,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -150,13 +143,12 @@ void Kernel::stop()
   m_ioContext.post(
     [this]()
     {
+      m_startupDelayTimer.cancel();
       m_heartbeatTimeout.cancel();
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
   m_inputValues.clear();
   m_outputValues.clear();
@@ -171,7 +163,7 @@ void Kernel::stop()
 void Kernel::receive(const Message& message)
 {
   if(m_config.debugLogRXTX && (message != Heartbeat() || m_config.debugLogHeartbeat))
-    EventLoop::call(
+    callEventLoop(
       [this, msg=toString(message)]()
       {
         Log::log(logId, LogMessage::D2002_RX_X, msg);
@@ -198,7 +190,7 @@ void Kernel::receive(const Message& message)
         {
           m_inputValues[address] = setInputState.state;
 
-          EventLoop::call(
+          callEventLoop(
             [this, address, state=setInputState.state]()
             {
               if(state == InputState::Invalid)
@@ -227,7 +219,7 @@ void Kernel::receive(const Message& message)
         {
           m_outputValues[address] = setOutputState.state;
 
-          EventLoop::call(
+          callEventLoop(
             [this, address, state=setOutputState.state]()
             {
               if(state == OutputState::Invalid)
@@ -257,7 +249,7 @@ void Kernel::receive(const Message& message)
 
         case ThrottleSubUnsub::Subscribe:
           throttleSubscribe(subUnsub.throttleId(), {subUnsub.address(), subUnsub.isLongAddress()});
-          EventLoop::call(
+          callEventLoop(
             [this, subUnsub]()
             {
               if(auto decoder = getDecoder(subUnsub.address(), subUnsub.isLongAddress()))
@@ -291,7 +283,7 @@ void Kernel::receive(const Message& message)
 
       throttleSubscribe(throttleSetFunction.throttleId(), {throttleSetFunction.address(), throttleSetFunction.isLongAddress()});
 
-      EventLoop::call(
+      callEventLoop(
         [this, throttleSetFunction]()
         {
           if(auto decoder = getDecoder(throttleSetFunction.address(), throttleSetFunction.isLongAddress()))
@@ -334,7 +326,7 @@ void Kernel::receive(const Message& message)
 
       throttleSubscribe(throttleSetSpeedDirection.throttleId(), {throttleSetSpeedDirection.address(), throttleSetSpeedDirection.isLongAddress()});
 
-      EventLoop::call(
+      callEventLoop(
         [this, throttleSetSpeedDirection]()
         {
           if(auto decoder = getDecoder(throttleSetSpeedDirection.address(), throttleSetSpeedDirection.isLongAddress()))
@@ -361,7 +353,7 @@ void Kernel::receive(const Message& message)
       m_featureFlags4 = features.featureFlags4;
 
       if(hasFeatureInput())
-        EventLoop::call(
+        callEventLoop(
           [this]()
           {
             for(const auto& it : m_inputController->inputMap())
@@ -369,7 +361,7 @@ void Kernel::receive(const Message& message)
           });
 
       if(hasFeatureOutput())
-        EventLoop::call(
+        callEventLoop(
           [this]()
           {
             for(const auto& it : m_outputController->outputMap())
@@ -380,7 +372,7 @@ void Kernel::receive(const Message& message)
     case OpCode::Info:
     {
       const auto& info = static_cast<const InfoBase&>(message);
-      EventLoop::call(
+      callEventLoop(
         [this, text=std::string(info.text())]()
         {
           Log::log(logId, LogMessage::I2005_X, text);
@@ -448,7 +440,7 @@ void Kernel::send(const Message& message)
   if(m_ioHandler->send(message))
   {
     if(m_config.debugLogRXTX && (message != Heartbeat() || m_config.debugLogHeartbeat))
-      EventLoop::call(
+      callEventLoop(
         [this, msg=toString(message)]()
         {
           Log::log(logId, LogMessage::D2001_TX_X, msg);
@@ -500,7 +492,7 @@ void Kernel::throttleSubscribe(uint16_t throttleId, std::pair<uint16_t, bool> ke
   auto [unused, added] = m_throttleSubscriptions[throttleId].insert(key);
   if(added)
   {
-    EventLoop::call(
+    callEventLoop(
       [this, key]()
       {
         if(auto it = m_decoderSubscriptions.find(key); it == m_decoderSubscriptions.end())
@@ -525,7 +517,7 @@ void Kernel::throttleUnsubscribe(uint16_t throttleId, std::pair<uint16_t, bool>
       m_throttleSubscriptions.erase(throttleId);
   }
 
-  EventLoop::call(
+  callEventLoop(
     [this, key]()
     {
       if(auto it = m_decoderSubscriptions.find(key); it != m_decoderSubscriptions.end())
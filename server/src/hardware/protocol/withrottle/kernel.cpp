@@ -32,7 +32,6 @@
 #include "../../../log/log.hpp"
 #include "../../../log/logmessageexception.hpp"
 #include "../../../utils/fromchars.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../utils/startswith.hpp"
 
 namespace WiThrottle {
@@ -122,13 +121,7 @@ void Kernel::start()
 
   m_powerOn = TriState::Undefined;
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("withrottle");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("withrottle");
 
   if(m_clock)
     m_clockChangeConnection = m_clock->onChange.connect(
@@ -146,7 +139,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -187,10 +180,9 @@ void Kernel::stop()
     [this]()
     {
       m_ioHandler->stop();
-      m_ioContext.stop();
     });
 
-  m_thread.join();
+  stopIOContext();
 }
 
 void Kernel::setPowerOn(bool on)
@@ -219,7 +211,7 @@ void Kernel::newClient(IOHandler::ClientId clientId)
   sendTo(rosterList({}), clientId);
   sendTo(trackPower(m_powerOn), clientId);
 
-  EventLoop::call(
+  callEventLoop(
     [this, clientId]()
     {
       postSendTo(fastClock((m_clock->hour * 60U + m_clock->minute) * 60U, m_clock->running ? m_clock->multiplier : 0), clientId);
@@ -241,7 +233,7 @@ void Kernel::clientGone(IOHandler::ClientId clientId)
   if(!m_running)
     return;
 
-  EventLoop::call(
+  callEventLoop(
     [this, clientId]()
     {
       if(auto itClient = m_clients.find(clientId); itClient != m_clients.end())
@@ -265,7 +257,7 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
   assert(m_running);
 
   if(m_config.debugLogRXTX)
-    EventLoop::call(
+    callEventLoop(
       [this, clientId, msg=std::string(message)]()
       {
         Log::log(logId, LogMessage::D2005_X_RX_X, clientId, msg);
@@ -309,7 +301,7 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
           if(!parseAddress(message, addressRepeat) || !message.empty() || address != addressRepeat)
             return;
 
-          EventLoop::call(
+          callEventLoop(
             [this, clientId, multiThrottleId, address, steal=(command == 'S')]()
             {
               const auto& throttle = getThottle(clientId, multiThrottleId);
@@ -362,7 +354,7 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
         }
         case '-':
         {
-          EventLoop::call(
+          callEventLoop(
             [this, clientId, multiThrottleId, address]()
             {
               auto* multiThrottle = getMultiThrottle(clientId, multiThrottleId);
@@ -389,7 +381,7 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
   }
   else if(message[0] == 'N') // throttle name
   {
-    EventLoop::call(
+    callEventLoop(
       [this, clientId, name=std::string(message.substr(1))]()
       {
         if(auto itClient = m_clients.find(clientId); itClient != m_clients.end())
@@ -402,7 +394,7 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
   }
   else if(startsWith(message, "HU")) // throttle id
   {
-    EventLoop::call(
+    callEventLoop(
       [this, clientId, id=std::string(message.substr(2))]()
       {
         if(auto itClient = m_clients.find(clientId); itClient != m_clients.end())
@@ -437,7 +429,7 @@ void Kernel::sendTo(std::string_view message, IOHandler::ClientId clientId)
   if(m_ioHandler->sendTo(message, clientId))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [this, clientId, msg=std::string(message)]()
         {
           Log::log(logId, LogMessage::D2004_X_TX_X, clientId, msg);
@@ -452,7 +444,7 @@ void Kernel::sendToAll(std::string_view message)
   if(m_ioHandler->hasClients() && m_ioHandler->sendToAll(message))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [this, msg=std::string(message)]()
         {
           Log::log(logId, LogMessage::D2001_TX_X, msg);
@@ -530,7 +522,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
       auto r = fromChars(message, value);
       if(r.ec == std::errc() && value <= speedMax)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, clientId, multiThrottleId, value]()
           {
             if(const auto& throttle = getThottle(clientId, multiThrottleId); throttle && throttle->acquired())
@@ -555,7 +547,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
       auto r = fromChars(message, value);
       if(r.ec == std::errc())
       {
-        EventLoop::call(
+        callEventLoop(
           [this, clientId, multiThrottleId, value]()
           {
             if(const auto& throttle = getThottle(clientId, multiThrottleId); throttle && throttle->acquired())
@@ -574,7 +566,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
       auto r = fromChars(message.substr(1), number);
       if(r.ec == std::errc())
       {
-        EventLoop::call(
+        callEventLoop(
           [this, clientId, multiThrottleId, number, force=(throttleCommand == ThrottleCommand::ForceFunction), value]()
           {
             if(const auto& throttle = getThottle(clientId, multiThrottleId); throttle && throttle->acquired())
@@ -594,7 +586,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
       break;
     }
     case ThrottleCommand::Idle:
-      EventLoop::call(
+      callEventLoop(
         [this, clientId, multiThrottleId]()
         {
           if(const auto& throttle = getThottle(clientId, multiThrottleId); throttle && throttle->acquired())
@@ -606,7 +598,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
       break;
 
     case ThrottleCommand::EmergencyStop:
-      EventLoop::call(
+      callEventLoop(
         [this, clientId, multiThrottleId]()
         {
           if(const auto& throttle = getThottle(clientId, multiThrottleId); throttle && throttle->acquired())
@@ -622,7 +614,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
         switch(message[0])
         {
           case 'V': // speed
-            EventLoop::call(
+            callEventLoop(
               [this, clientId, multiThrottleId]()
               {
                 if(const auto* multiThrottle = getMultiThrottle(clientId, multiThrottleId))
@@ -636,7 +628,7 @@ void Kernel::multiThrottleAction(IOHandler::ClientId clientId, char multiThrottl
             break;
 
           case 'R': // direction
-            EventLoop::call(
+            callEventLoop(
               [this, clientId, multiThrottleId]()
               {
                 if(const auto* multiThrottle = getMultiThrottle(clientId, multiThrottleId))
@@ -104,7 +104,7 @@ void HardwareIOHandler::processRead(size_t bytesTransferred)
 
     if(drop != 0)
     {
-      EventLoop::call(
+      m_kernel.callEventLoop(
         [this, drop]()
         {
           Log::log(m_kernel.logId, LogMessage::W2001_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES, drop);
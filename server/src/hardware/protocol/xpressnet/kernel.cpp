@@ -25,7 +25,6 @@
 #include "../../decoder/decoder.hpp"
 #include "../../decoder/decoderchangeflags.hpp"
 #include "../../input/inputcontroller.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../core/eventloop.hpp"
 #include "../../../log/log.hpp"
 #include "../../../log/logmessageexception.hpp"
@@ -61,13 +60,7 @@ void Kernel::start()
   m_emergencyStop = TriState::Undefined;
   m_inputValues.fill(TriState::Undefined);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("xpressnet");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("xpressnet");
 
   m_ioContext.post(
     [this]()
@@ -78,7 +71,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -103,9 +96,7 @@ void Kernel::stop()
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
 #ifndef NDEBUG
   m_started = false;
@@ -115,7 +106,7 @@ void Kernel::stop()
 void Kernel::receive(const Message& message)
 {
   if(m_config.debugLogRXTX)
-    EventLoop::call(
+    callEventLoop(
       [this, msg=toString(message)]()
       {
         Log::log(logId, LogMessage::D2002_RX_X, msg);
@@ -150,7 +141,7 @@ void Kernel::receive(const Message& message)
                 if(m_inputValues[fullAddress] != value)
                 {
                   if(m_config.debugLogInput)
-                    EventLoop::call(
+                    callEventLoop(
                       [this, address=1 + fullAddress, value]()
                       {
                         Log::log(logId, LogMessage::D2007_INPUT_X_IS_X, address, value == TriState::True ? std::string_view{"1"} : std::string_view{"0"});
@@ -158,7 +149,7 @@ void Kernel::receive(const Message& message)
 
                   m_inputValues[fullAddress] = value;
 
-                  EventLoop::call(
+                  callEventLoop(
                     [this, address=1 + fullAddress, value]()
                     {
                       m_inputController->updateInputValue(InputController::defaultInputChannel, address, value);
@@ -184,7 +175,7 @@ void Kernel::receive(const Message& message)
           m_emergencyStop = TriState::False;
 
           if(m_onNormalOperationResumed)
-            EventLoop::call(
+            callEventLoop(
               [this]()
               {
                 m_onNormalOperationResumed();
@@ -198,7 +189,7 @@ void Kernel::receive(const Message& message)
           m_trackPowerOn = TriState::False;
 
           if(m_onTrackPowerOff)
-            EventLoop::call(
+            callEventLoop(
               [this]()
               {
                 m_onTrackPowerOff();
@@ -215,7 +206,7 @@ void Kernel::receive(const Message& message)
           m_emergencyStop = TriState::True;
 
           if(m_onEmergencyStop)
-            EventLoop::call(
+            callEventLoop(
               [this]()
               {
                 m_onEmergencyStop();
@@ -446,7 +437,7 @@ void Kernel::send(const Message& message)
   if(m_ioHandler->send(message))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [this, msg=toString(message)]()
         {
           Log::log(logId, LogMessage::D2001_TX_X, msg);
@@ -53,7 +53,7 @@ void ClientKernel::setConfig(const ClientConfig& config)
 void ClientKernel::receive(const Message& message)
 {
   if(m_config.debugLogRXTX)
-    EventLoop::call(
+    callEventLoop(
       [logId_=logId, msg=toString(message)]()
       {
         Log::log(logId_, LogMessage::D2002_RX_X, msg);
@@ -73,7 +73,7 @@ void ClientKernel::receive(const Message& message)
         case LAN_X_BC:
           if(message == LanXBCTrackPowerOff() || message == LanXBCTrackShortCircuit())
           {
-            EventLoop::call(
+            callEventLoop(
               [this]()
               {
                 if(m_trackPowerOn != TriState::False)
@@ -86,7 +86,7 @@ void ClientKernel::receive(const Message& message)
           }
           else if(message == LanXBCTrackPowerOn())
           {
-            EventLoop::call(
+            callEventLoop(
               [this]()
               {
                 if(m_trackPowerOn != TriState::True)
@@ -102,7 +102,7 @@ void ClientKernel::receive(const Message& message)
         case LAN_X_BC_STOPPED:
           if(message == LanXBCStopped())
           {
-            EventLoop::call(
+            callEventLoop(
               [this]()
               {
                 if(m_emergencyStop != TriState::True)
@@ -229,7 +229,7 @@ void ClientKernel::receive(const Message& message)
             //Store last received speed step converted to 126 steps scale
             cache.lastReceivedSpeedStep = currentSpeedStep;
 
-            EventLoop::call(
+            callEventLoop(
               [this, address=reply.address(), isEStop=reply.isEmergencyStop(),
               speed = reply.speedStep(), speedMax=reply.speedSteps(),
               dir = reply.direction(), val, functionIndexMax, changes]()
@@ -290,7 +290,7 @@ void ClientKernel::receive(const Message& message)
           m_serialNumber = reply.serialNumber();
           if(m_onSerialNumberChanged)
           {
-            EventLoop::call(
+            callEventLoop(
               [this, serialNumber=m_serialNumber]()
               {
                 m_onSerialNumberChanged(serialNumber);
@@ -315,7 +315,7 @@ void ClientKernel::receive(const Message& message)
 
           if(m_onHardwareInfoChanged)
           {
-            EventLoop::call(
+            callEventLoop(
               [this, hardwareType=m_hardwareType, firmwareVersionMajor=m_firmwareVersionMajor, firmwareVersionMinor=m_firmwareVersionMinor]()
               {
                 m_onHardwareInfoChanged(hardwareType, firmwareVersionMajor, firmwareVersionMinor);
@@ -338,7 +338,7 @@ void ClientKernel::receive(const Message& message)
           {
             m_rbusFeedbackStatus[index] = value;
 
-            EventLoop::call(
+            callEventLoop(
               [this, address=rbusAddressMin + index, value]()
               {
                 m_inputController->updateInputValue(InputChannel::rbus, address, value);
@@ -362,7 +362,7 @@ void ClientKernel::receive(const Message& message)
             {
               m_loconetFeedbackStatus[index] = value;
 
-              EventLoop::call(
+              callEventLoop(
                 [this, address=loconetAddressMin + index, value]()
                 {
                   m_inputController->updateInputValue(InputChannel::loconet, address, value);
@@ -409,7 +409,7 @@ void ClientKernel::receive(const Message& message)
         const TriState trackPowerOn = toTriState(isTrackPowerOn);
         const TriState stopState = toTriState(isStop);
 
-        EventLoop::call([this, trackPowerOn, stopState]()
+        callEventLoop([this, trackPowerOn, stopState]()
           {
             if(m_trackPowerOn != trackPowerOn)
             {
@@ -751,7 +751,7 @@ void ClientKernel::send(const Message& message)
   if(m_ioHandler->send(message))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [logId_=logId, msg=toString(message)]()
         {
           Log::log(logId_, LogMessage::D2001_TX_X, msg);
@@ -88,7 +88,7 @@ void UDPClientIOHandler::send()
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
-        EventLoop::call(
+        m_kernel.callEventLoop(
           [this, ec]()
           {
             Log::log(m_kernel.logId, LogMessage::E2011_SOCKET_SEND_FAILED_X, ec);
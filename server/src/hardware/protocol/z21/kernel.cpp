@@ -26,7 +26,6 @@
 #include "../../decoder/decoder.hpp"
 #include "../../decoder/decoderchangeflags.hpp"
 #include "../../input/inputcontroller.hpp"
-#include "../../../utils/setthreadname.hpp"
 #include "../../../core/eventloop.hpp"
 #include "../../../log/log.hpp"
 #include "../../../log/logmessageexception.hpp"
@@ -43,13 +42,7 @@ void Kernel::start()
   assert(m_ioHandler);
   assert(!m_started);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("z21");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startIOContext("z21");
 
   m_ioContext.post(
     [this]()
@@ -60,7 +53,7 @@ void Kernel::start()
       }
       catch(const LogMessageException& e)
       {
-        EventLoop::call(
+        callEventLoop(
           [this, e]()
           {
             Log::log(logId, e.message(), e.args());
@@ -89,9 +82,7 @@ void Kernel::stop()
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
+  stopIOContext();
 
 #ifndef NDEBUG
   m_started = false;
@@ -78,7 +78,7 @@ void ServerKernel::setState(bool trackPowerOn, bool emergencyStop)
 void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clientId)
 {
   if(m_config.debugLogRXTX)
-    EventLoop::call(
+    callEventLoop(
       [this, clientId, msg=toString(message)]()
       {
         Log::log(logId, LogMessage::D2005_X_RX_X, clientId, msg);
@@ -116,7 +116,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
           {
             if(m_config.allowTrackPowerOnReleaseEmergencyStop && (m_trackPowerOn != TriState::True || m_emergencyStop != TriState::False) && m_onTrackPowerOn)
             {
-              EventLoop::call(
+              callEventLoop(
                 [this]()
                 {
                   m_onTrackPowerOn();
@@ -127,7 +127,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
           {
             if(m_config.allowTrackPowerOff && m_trackPowerOn != TriState::False && m_onTrackPowerOff)
             {
-              EventLoop::call(
+              callEventLoop(
                 [this]()
                 {
                   m_onTrackPowerOff();
@@ -141,7 +141,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
           {
             if(m_config.allowEmergencyStop && m_emergencyStop != TriState::True && m_onEmergencyStop)
             {
-              EventLoop::call(
+              callEventLoop(
                 [this]()
                 {
                   m_onEmergencyStop();
@@ -156,7 +156,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
           {
             subscribe(clientId, getLocoInfo.address(), getLocoInfo.isLongAddress());
 
-            EventLoop::call(
+            callEventLoop(
               [this, getLocoInfo, clientId]()
               {
                 if(auto decoder = getDecoder(getLocoInfo.address(), getLocoInfo.isLongAddress()))
@@ -171,7 +171,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
           {
             subscribe(clientId, setLocoDrive.address(), setLocoDrive.isLongAddress());
 
-            EventLoop::call(
+            callEventLoop(
               [this, setLocoDrive]()
               {
                 if(auto decoder = getDecoder(setLocoDrive.address(), setLocoDrive.isLongAddress()))
@@ -190,7 +190,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
           {
             subscribe(clientId, setLocoFunction.address(), setLocoFunction.isLongAddress());
 
-            EventLoop::call(
+            callEventLoop(
               [this, setLocoFunction]()
               {
                 if(auto decoder = getDecoder(setLocoFunction.address(), setLocoFunction.isLongAddress()))
@@ -304,7 +304,7 @@ void ServerKernel::sendTo(const Message& message, IOHandler::ClientId clientId)
   if(m_ioHandler->sendTo(message, clientId))
   {
     if(m_config.debugLogRXTX)
-      EventLoop::call(
+      callEventLoop(
         [this, clientId, msg=toString(message)]()
         {
           Log::log(logId, LogMessage::D2004_X_TX_X, clientId, msg);
@@ -360,7 +360,7 @@ void ServerKernel::subscribe(IOHandler::ClientId clientId, uint16_t address, boo
   if(subscriptions.size() > ServerConfig::subscriptionMax)
     unsubscribe(clientId, *subscriptions.begin());
 
-  EventLoop::call(
+  callEventLoop(
     [this, key]()
     {
       if(auto it = m_decoderSubscriptions.find(key); it == m_decoderSubscriptions.end())
@@ -384,7 +384,7 @@ void ServerKernel::unsubscribe(IOHandler::ClientId clientId, std::pair<uint16_t,
       subscriptions.erase(it);
   }
 
-  EventLoop::call(
+  callEventLoop(
     [this, key]()
     {
       if(auto it = m_decoderSubscriptions.find(key); it != m_decoderSubscriptions.end())
@@ -401,7 +401,7 @@ void ServerKernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags /*c
   const std::pair<uint16_t, bool> key(decoder.address, decoder.protocol == DecoderProtocol::DCCLong);
   const LanXLocoInfo message(decoder);
 
-  EventLoop::call(
+  callEventLoop(
     [this, key, message]()
     {
       for(auto it : m_clients)
@@ -47,7 +47,7 @@ void MemoryLogger::add(std::chrono::system_clock::time_point time, std::string o
   }
   else
   {
-    EventLoop::call(
+    m_eventLoopQueue.call(
       [this, time=std::move(time), objectId=std::move(objectId), message, args]()
       {
         add(std::move(time), std::move(objectId), message, args);
@@ -27,6 +27,7 @@
 #include <list>
 #include <functional>
 #include <boost/signals2/signal.hpp>
+#include "../core/eventloopqueue.hpp"
 
 class MemoryLogger : public Logger
 {
@@ -50,6 +51,7 @@ class MemoryLogger : public Logger
   private:
     std::vector<Log> m_logs;
     size_t m_sizeMax;
+    EventLoopQueue m_eventLoopQueue;
 
     void add(std::chrono::system_clock::time_point time, std::string objectId, LogMessage message, std::vector<std::string>* args);
     uint32_t cleanUp();
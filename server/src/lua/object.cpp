@@ -24,6 +24,7 @@
 #include "object/object.hpp"
 #include "object/objectlist.hpp"
 #include "object/loconetinterface.hpp"
+#include "object/board.hpp"
 
 namespace Lua::Object {
 
@@ -34,6 +35,7 @@ void registerTypes(lua_State* L)
   Object::registerType(L);
   ObjectList::registerType(L);
   LocoNetInterface::registerType(L);
+  Board::registerType(L);
 
   // weak table for object userdata:
   lua_newtable(L);
@@ -63,6 +65,8 @@ void push(lua_State* L, const ObjectPtr& value)
 
       if(dynamic_cast<::LocoNetInterface*>(value.get()))
         luaL_setmetatable(L, LocoNetInterface::metaTableName);
+      else if(dynamic_cast<::Board*>(value.get()))
+        luaL_setmetatable(L, Board::metaTableName);
       else if(dynamic_cast<AbstractObjectList*>(value.get()))
         luaL_setmetatable(L, ObjectList::metaTableName);
       else
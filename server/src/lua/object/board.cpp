@@ -0,0 +1,96 @@
+/**
+ * server/src/lua/object/board.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "board.hpp"
+#include "object.hpp"
+#include "../check.hpp"
+#include "../checkarguments.hpp"
+#include "../push.hpp"
+#include "../to.hpp"
+#include "../metatable.hpp"
+#include "../../board/map/blockpath.hpp"
+#include "../../board/tile/rail/blockrailtile.hpp"
+
+namespace Lua::Object {
+
+//! Push route as table of blocks from start to end block followed by the route cost, or \c nil if there is no route.
+static int pushRoute(lua_State* L, const std::shared_ptr<::BlockRailTile>& from, const BlockRoutes::Route& route)
+{
+  if(route.empty())
+  {
+    lua_pushnil(L);
+    return 1;
+  }
+
+  lua_createtable(L, static_cast<int>(route.paths.size() + 1), 0);
+  Lua::push(L, from);
+  lua_rawseti(L, -2, 1);
+  lua_Integer n = 2;
+  for(const auto& path : route.paths)
+  {
+    Lua::push(L, path->toBlock());
+    lua_rawseti(L, -2, n++);
+  }
+  Lua::push(L, route.cost);
+  return 2;
+}
+
+void Board::registerType(lua_State* L)
+{
+  MetaTable::clone(L, Object::metaTableName, metaTableName);
+  lua_pushcfunction(L, __index);
+  lua_setfield(L, -2, "__index");
+  lua_pop(L, 1);
+}
+
+int Board::index(lua_State* L, ::Board& object)
+{
+  const auto key = to<std::string_view>(L, 2);
+  LUA_OBJECT_METHOD(find_route)
+  LUA_OBJECT_METHOD(find_free_route)
+  return Object::index(L, object);
+}
+
+int Board::__index(lua_State* L)
+{
+  return index(L, *check<::Board>(L, 1));
+}
+
+int Board::find_route(lua_State* L)
+{
+  checkArguments(L, 2);
+  auto board = check<::Board>(L, lua_upvalueindex(1));
+  auto from = check<::BlockRailTile>(L, 1);
+  auto to = check<::BlockRailTile>(L, 2);
+  return pushRoute(L, from, board->findRoute(*from, *to));
+}
+
+int Board::find_free_route(lua_State* L)
+{
+  checkArguments(L, 2);
+  auto board = check<::Board>(L, lua_upvalueindex(1));
+  auto from = check<::BlockRailTile>(L, 1);
+  auto to = check<::BlockRailTile>(L, 2);
+  return pushRoute(L, from, board->findFreeRoute(*from, *to));
+}
+
+}
@@ -38,11 +38,12 @@
 #include <version.hpp>
 #include <traintastic/utils/str.hpp>
 #include "../world/world.hpp"
+#include "../traintastic/traintastic.hpp"
 
 #define LUA_SANDBOX "_sandbox"
 #define LUA_SANDBOX_GLOBALS "_sandbox_globals"
 
-constexpr std::array<std::string_view, 23> readOnlyGlobals = {{
+constexpr std::array<std::string_view, 24> readOnlyGlobals = {{
   // Lua baselib:
   "assert",
   "type",
@@ -66,6 +67,7 @@ constexpr std::array<std::string_view, 23> readOnlyGlobals = {{
   // Objects:
   "world",
   "log",
+  "diagnostics",
   // Functions:
   "is_instance",
   // Type info:
@@ -221,6 +223,13 @@ SandboxPtr Sandbox::create(Script& script)
   push(L, script.world().shared_from_this());
   lua_setfield(L, -2, "world");
 
+  // add diagnostics:
+  if(::Traintastic::instance)
+    push(L, ::Traintastic::instance->diagnostics.value());
+  else
+    lua_pushnil(L);
+  lua_setfield(L, -2, "diagnostics");
+
   // add logger:
   Log::push(L);
   lua_setfield(L, -2, "log");
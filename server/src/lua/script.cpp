@@ -32,13 +32,27 @@
 #include "../core/objectproperty.tpp"
 #include "../world/worldloader.hpp"
 #include "../world/worldsaver.hpp"
+#include "../world/worldjournal.hpp"
 #include "../utils/displayname.hpp"
 #include "../log/log.hpp"
 
 namespace Lua {
 
-constexpr std::string_view scripts = "scripts";
-constexpr std::string_view dotLua = ".lua";
+std::string Script::compile(const std::string& code)
+{
+  std::unique_ptr<lua_State, void(*)(lua_State*)> L{luaL_newstate(), lua_close};
+  if(!L || luaL_loadbuffer(L.get(), code.c_str(), code.size(), "=") != LUA_OK)
+    return {}; // error is reported when the script is started
+
+  std::string chunk;
+  lua_dump(L.get(),
+    [](lua_State* /*L*/, const void* p, size_t size, void* ud) -> int
+    {
+      static_cast<std::string*>(ud)->append(static_cast<const char*>(p), size);
+      return 0;
+    }, &chunk, 0);
+  return chunk;
+}
 
 Script::Script(World& world, std::string_view _id) :
   IdObject(world, _id),
@@ -51,7 +65,12 @@ Script::Script(World& world, std::string_view _id) :
       setState(value ? LuaScriptState::Disabled : LuaScriptState::Stopped);
     }},
   state{this, "state", LuaScriptState::Stopped, PropertyFlags::ReadOnly | PropertyFlags::Store},
-  code{this, "code", "", PropertyFlags::ReadWrite | PropertyFlags::NoStore},
+  code{this, "code", "", PropertyFlags::ReadWrite | PropertyFlags::NoStore,
+    [this](const std::string& /*value*/)
+    {
+      m_chunk.clear();
+      WorldJournal::changed(*this); // code is stored in a separate file, see save()
+    }},
   error{this, "error", "", PropertyFlags::ReadOnly | PropertyFlags::NoStore},
   start{*this, "start",
     [this]()
@@ -89,9 +108,13 @@ void Script::load(WorldLoader& loader, const nlohmann::json& data)
   IdObject::load(loader, data);
 
   m_basename = id;
+  const auto filename = std::filesystem::path(scripts) / m_basename += dotLua;
   std::string s;
-  if(loader.readFile(std::filesystem::path(scripts) / m_basename += dotLua, s))
+  if(loader.readFile(filename, s))
+  {
     code.loadJSON(s);
+    m_chunk = loader.takeLuaChunk(filename);
+  }
 }
 
 void Script::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& stateData) const
@@ -208,7 +231,11 @@ void Script::startSandbox()
   {
     Log::log(*this, LogMessage::N9001_STARTING_SCRIPT);
     lua_State* L = m_sandbox.get();
-    const int r = luaL_loadbuffer(L, code.value().c_str(), code.value().size(), "=") || Sandbox::pcall(L, 0, LUA_MULTRET);
+    const int r =
+      (m_chunk.empty() ?
+        luaL_loadbuffer(L, code.value().c_str(), code.value().size(), "=") :
+        luaL_loadbufferx(L, m_chunk.data(), m_chunk.size(), "=", "b")) ||
+      Sandbox::pcall(L, 0, LUA_MULTRET);
     if(r == LUA_OK)
     {
       setState(LuaScriptState::Running);
@@ -34,6 +34,7 @@ class Script : public IdObject
 {
   private:
     mutable std::string m_basename; //!< filename on disk for script
+    std::string m_chunk; //!< precompiled code, empty if not available
 
   protected:
     SandboxPtr m_sandbox;
@@ -56,6 +57,14 @@ class Script : public IdObject
     CLASS_ID("lua.script")
     CREATE(Script)
 
+    static constexpr std::string_view scripts = "scripts"; //!< directory for script code
+    static constexpr std::string_view dotLua = ".lua";
+
+    //! \brief Compile script code to a binary Lua chunk
+    //! Uses its own Lua state, so it can be used by any thread.
+    //! \return Binary chunk or an empty string if compiling failed
+    static std::string compile(const std::string& code);
+
     Script(World& world, std::string_view _id);
 
     Property<std::string> name;
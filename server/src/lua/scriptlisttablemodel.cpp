@@ -75,6 +75,14 @@ std::string ScriptListTableModel::getText(uint32_t column, uint32_t row) const
   return "";
 }
 
+TableModel::SortKey ScriptListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount() && column == columnState)
+    return static_cast<double>(getItem(row).state.value());
+
+  return getText(column, row);
+}
+
 void ScriptListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   if(property.name() == "id")
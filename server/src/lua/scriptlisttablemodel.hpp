@@ -45,6 +45,7 @@ class ScriptListTableModel : public ObjectListTableModel<Script>
     ScriptListTableModel(ScriptList& list);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 }
@@ -26,11 +26,45 @@
 #include "../core/eventloop.hpp"
 #include "session.hpp"
 #include "../log/log.hpp"
+#include "../utils/zlib.hpp"
+#include <cstring>
+#include <limits>
 
 #ifndef NDEBUG
   #define IS_SERVER_THREAD (std::this_thread::get_id() == m_server.threadId())
 #endif
 
+size_t Connection::WriteItem::size() const
+{
+  return message ? message->size() : sharedMessage->size();
+}
+
+std::array<boost::asio::const_buffer, 3> Connection::WriteItem::buffers() const
+{
+  if(message)
+    return {boost::asio::buffer(**message, message->size()), boost::asio::const_buffer(), boost::asio::const_buffer()};
+
+  // replace object handle:
+  const auto* data = static_cast<const uint8_t*>(**sharedMessage);
+  constexpr size_t tailOffset = handleOffset + sizeof(ObjectHandle);
+  return {
+    boost::asio::buffer(data, handleOffset),
+    boost::asio::buffer(&handle, sizeof(handle)),
+    boost::asio::buffer(data + tailOffset, sharedMessage->size() - tailOffset)};
+}
+
+Connection::ConflationKey::ConflationKey(const WriteItem& item)
+  : handle{item.handle}
+{
+  assert(item.sharedMessage);
+
+  // shared message is an object property changed event: handle, property name, ...
+  const auto* data = static_cast<const char*>(**item.sharedMessage) + WriteItem::handleOffset + sizeof(ObjectHandle);
+  Message::Length length;
+  memcpy(&length, data, sizeof(length));
+  propertyName = {data + sizeof(length), length};
+}
+
 Connection::Connection(Server& server, boost::asio::ip::tcp::socket socket, std::string id_)
   : m_server{server}
   , m_socket(std::move(socket))
@@ -68,11 +102,16 @@ void Connection::doReadHeader()
 
         if(!ec)
         {
-          m_readBuffer.message.reset(new Message(m_readBuffer.header));
+          m_readBuffer.message = std::make_shared<Message>(m_readBuffer.header);
           if(m_readBuffer.message->dataSize() == 0)
           {
             if(m_readBuffer.message->command() != Message::Command::Ping)
-              EventLoop::call(&Connection::processMessage, this, m_readBuffer.message);
+              EventLoop::call(
+                [weak, message=m_readBuffer.message]()
+                {
+                  if(auto connection = weak.lock())
+                    connection->processMessage(message);
+                });
             else
               {} // TODO: ping hier replyen
             m_readBuffer.message.reset();
@@ -83,12 +122,22 @@ void Connection::doReadHeader()
         }
         else if(ec == boost::asio::error::eof || ec == boost::asio::error::connection_aborted || ec == boost::asio::error::connection_reset)
         {
-          EventLoop::call(std::bind(&Connection::connectionLost, this));
+          EventLoop::call(
+            [weak]()
+            {
+              if(auto connection = weak.lock())
+                connection->connectionLost();
+            });
         }
         else if(ec != boost::asio::error::operation_aborted)
         {
           Log::log(id, LogMessage::E1007_SOCKET_READ_FAILED_X, ec);
-          EventLoop::call(std::bind(&Connection::disconnect, this));
+          EventLoop::call(
+            [weak]()
+            {
+              if(auto connection = weak.lock())
+                connection->disconnect();
+            });
         }
       });
 }
@@ -108,7 +157,12 @@ void Connection::doReadData()
           if(!ec)
           {
             if(m_readBuffer.message->command() != Message::Command::Ping)
-              EventLoop::call(&Connection::processMessage, this, m_readBuffer.message);
+              EventLoop::call(
+                [weak, message=m_readBuffer.message]()
+                {
+                  if(auto connection = weak.lock())
+                    connection->processMessage(message);
+                });
             else
             {} // TODO: ping hier replyen
             m_readBuffer.message.reset();
@@ -116,12 +170,22 @@ void Connection::doReadData()
           }
           else if(ec == boost::asio::error::eof || ec == boost::asio::error::connection_aborted || ec == boost::asio::error::connection_reset)
           {
-            EventLoop::call(std::bind(&Connection::connectionLost, this));
+            EventLoop::call(
+              [weak]()
+              {
+                if(auto connection = weak.lock())
+                  connection->connectionLost();
+              });
           }
           else if(ec != boost::asio::error::operation_aborted)
           {
             Log::log(id, LogMessage::E1007_SOCKET_READ_FAILED_X, ec);
-            EventLoop::call(std::bind(&Connection::disconnect, this));
+            EventLoop::call(
+              [weak]()
+              {
+                if(auto connection = weak.lock())
+                  connection->disconnect();
+              });
           }
         });
 }
@@ -129,8 +193,41 @@ void Connection::doReadData()
 void Connection::doWrite()
 {
   assert(IS_SERVER_THREAD);
+  assert(!m_writeQueue.empty() && m_writeCount == 0);
+
+  // gather queued messages into a single write:
+  size_t bytes = 0;
+  m_writeBuffers.clear();
+  for(const auto& item : m_writeQueue)
+  {
+    if(m_writeCount != 0 && bytes + item.size() > writeBatchSizeMax)
+      break;
+
+    // a message being written can't be replaced anymore:
+    if(item.sharedMessage)
+      if(auto it = m_writeQueueConflation.find(ConflationKey(item)); it != m_writeQueueConflation.end() && it->second == &item)
+        m_writeQueueConflation.erase(it);
+
+    for(const auto& buffer : item.buffers())
+      if(buffer.size() != 0)
+        m_writeBuffers.emplace_back(buffer);
+
+    bytes += item.size();
+    m_writeCount++;
+  }
+
+  writeMessageCount.fetch_add(m_writeCount, std::memory_order_relaxed);
+  writeByteCount.fetch_add(bytes, std::memory_order_relaxed);
 
-  boost::asio::async_write(m_socket, boost::asio::buffer(**m_writeQueue.front(), m_writeQueue.front()->size()),
+  boost::asio::async_write(m_socket, m_writeBuffers,
+    [](const boost::system::error_code& ec, std::size_t /*bytesTransferred*/) -> std::size_t
+    {
+      // called before every write operation, except after the last one:
+      if(ec)
+        return 0;
+      writeSyscallCount.fetch_add(1, std::memory_order_relaxed);
+      return std::numeric_limits<std::size_t>::max();
+    },
     [this, weak=weak_from_this()](const boost::system::error_code& ec, std::size_t /*bytesTransferred*/)
     {
       if(weak.expired())
@@ -138,14 +235,23 @@ void Connection::doWrite()
 
       if(!ec)
       {
-        m_writeQueue.pop();
+        for(; m_writeCount != 0; m_writeCount--)
+        {
+          updateWriteBacklog(-static_cast<ptrdiff_t>(m_writeQueue.front().size()));
+          m_writeQueue.pop_front();
+        }
         if(!m_writeQueue.empty())
           doWrite();
       }
       else if(ec != boost::asio::error::operation_aborted)
       {
         Log::log(id, LogMessage::E1006_SOCKET_WRITE_FAILED_X, ec);
-        EventLoop::call(std::bind(&Connection::disconnect, this));
+        EventLoop::call(
+          [weak]()
+          {
+            if(auto connection = weak.lock())
+              connection->disconnect();
+          });
       }
     });
 }
@@ -176,7 +282,21 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
     if(message->command() == Message::Command::Login && message->type() == Message::Type::Request)
     {
       m_authenticated = true; // oke for now, login can be added later :)
-      sendMessage(Message::newResponse(message->command(), message->requestId()));
+
+      // username and password, followed by the supported features (optional, older clients don't send them):
+      Message::Features features = 0;
+      if(!message->endOfMessage())
+        message->read<std::string_view>();
+      if(!message->endOfMessage())
+        message->read<std::string_view>();
+      if(!message->endOfMessage())
+        features = message->read<Message::Features>();
+
+      m_compression = (features & Message::featureCompression) != 0;
+
+      auto response = Message::newResponse(message->command(), message->requestId());
+      response->write<Message::Features>(m_compression ? Message::featureCompression : 0);
+      sendMessage(std::move(response));
       return;
     }
   }
@@ -193,15 +313,121 @@ void Connection::sendMessage(std::unique_ptr<Message> message)
   assert(isEventLoopThread());
 
   m_server.m_ioContext.post(
-    [this, msg=std::make_shared<std::unique_ptr<Message>>(std::move(message))]()
+    [this, msg=std::make_shared<std::unique_ptr<Message>>(std::move(message)), compression=m_compression]()
+    {
+      if(compression && (**msg).dataSize() > compressionThreshold)
+        if(auto compressed = compress(**msg))
+          *msg = std::move(compressed);
+
+      queueWrite({std::move(*msg), nullptr, 0});
+    });
+}
+
+void Connection::sendMessage(std::shared_ptr<const Message> message, ObjectHandle handle)
+{
+  assert(isEventLoopThread());
+  assert(message->size() >= WriteItem::handleOffset + sizeof(ObjectHandle));
+
+  m_server.m_ioContext.post(
+    [this, msg=std::move(message), handle]()
     {
-      const bool wasEmpty = m_writeQueue.empty();
-      m_writeQueue.emplace(std::move(*msg));
-      if(wasEmpty)
-        doWrite();
+      queueWriteConflated({nullptr, msg, handle});
     });
 }
 
+std::unique_ptr<Message> Connection::compress(const Message& message)
+{
+  assert(IS_SERVER_THREAD);
+  assert(!message.isCompressed());
+
+  static constexpr size_t sizeLength = sizeof(uint32_t);
+  static constexpr int level = 1; // fastest, most gain is from the many repeated names
+
+  m_compressBuffer.resize(sizeLength + ZLib::compressBound(message.dataSize()));
+  size_t compressedSize = m_compressBuffer.size() - sizeLength;
+  if(!ZLib::compress(message.data(), message.dataSize(), m_compressBuffer.data() + sizeLength, compressedSize, level) ||
+      sizeLength + compressedSize >= message.dataSize())
+    return {}; // failed or not smaller, send uncompressed
+
+  const uint32_t dataSize = message.dataSize();
+  m_compressBuffer[0] = static_cast<uint8_t>(dataSize >> 24); // big endian, see Message::featureCompression
+  m_compressBuffer[1] = static_cast<uint8_t>(dataSize >> 16);
+  m_compressBuffer[2] = static_cast<uint8_t>(dataSize >> 8);
+  m_compressBuffer[3] = static_cast<uint8_t>(dataSize);
+
+  Message::Header header = *static_cast<const Message::Header*>(*message);
+  header.flags.compressed = 1;
+  header.dataSize = static_cast<uint32_t>(sizeLength + compressedSize);
+  auto compressed = std::make_unique<Message>(header);
+  std::memcpy(compressed->data(), m_compressBuffer.data(), header.dataSize);
+  return compressed;
+}
+
+void Connection::queueWrite(WriteItem item)
+{
+  assert(IS_SERVER_THREAD);
+
+  if(m_writeBacklogExceeded)
+    return; // disconnecting
+
+  const bool wasEmpty = m_writeQueue.empty();
+  updateWriteBacklog(static_cast<ptrdiff_t>(item.size()));
+  m_writeQueue.emplace_back(std::move(item));
+  if(wasEmpty)
+  {
+    doWrite();
+  }
+  else if(m_writeBacklog > writeBacklogMax)
+  {
+    m_writeBacklogExceeded = true;
+    slowClientDisconnectCount++;
+    Log::log(id, LogMessage::W1005_WRITE_BACKLOG_EXCEEDS_X_BYTES_DISCONNECTING, writeBacklogMax);
+    EventLoop::call(
+      [weak=weak_from_this()]()
+      {
+        if(auto connection = weak.lock())
+          connection->disconnect();
+      });
+  }
+}
+
+void Connection::queueWriteConflated(WriteItem item)
+{
+  assert(IS_SERVER_THREAD);
+  assert(item.sharedMessage);
+
+  if(m_writeBacklogExceeded)
+    return; // disconnecting
+
+  if(m_writeQueue.empty())
+  {
+    queueWrite(std::move(item)); // written immediately, nothing to conflate
+    return;
+  }
+
+  // replace the value of a queued change of the same property, the client only needs the latest:
+  if(auto it = m_writeQueueConflation.find(ConflationKey(item)); it != m_writeQueueConflation.end())
+  {
+    WriteItem& queued = *it->second;
+    m_writeQueueConflation.erase(it); // key refers to the replaced message
+    updateWriteBacklog(static_cast<ptrdiff_t>(item.size()) - static_cast<ptrdiff_t>(queued.size()));
+    queued.sharedMessage = std::move(item.sharedMessage);
+    m_writeQueueConflation.emplace(ConflationKey(queued), &queued);
+    conflatedCount++;
+    return;
+  }
+
+  queueWrite(std::move(item));
+  if(!m_writeBacklogExceeded)
+    m_writeQueueConflation.emplace(ConflationKey(m_writeQueue.back()), &m_writeQueue.back()); // pushing to a std::deque doesn't invalidate references
+}
+
+void Connection::updateWriteBacklog(ptrdiff_t delta)
+{
+  m_writeBacklog += delta;
+  m_writeBacklogStat.store(static_cast<uint32_t>(std::min<size_t>(m_writeBacklog, std::numeric_limits<uint32_t>::max())), std::memory_order_relaxed);
+}
+
 void Connection::connectionLost()
 {
   assert(isEventLoopThread());
@@ -23,8 +23,13 @@
 #ifndef TRAINTASTIC_SERVER_NETWORK_CONNECTION_HPP
 #define TRAINTASTIC_SERVER_NETWORK_CONNECTION_HPP
 
+#include <array>
+#include <atomic>
 #include <memory>
-#include <queue>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include <boost/asio.hpp>
 #include "../core/objectptr.hpp"
 #include <traintastic/network/message.hpp>
@@ -39,6 +44,41 @@ class Connection : public std::enable_shared_from_this<Connection>
   protected:
     using ObjectHandle = uint32_t;
 
+    struct WriteItem
+    {
+      //! Offset of the object handle in a shared message
+      static constexpr size_t handleOffset = sizeof(Message::Header);
+
+      std::unique_ptr<Message> message; //!< message for this connection only
+      std::shared_ptr<const Message> sharedMessage; //!< message shared with other connections, only the object handle differs
+      ObjectHandle handle = 0; //!< object handle to send instead of the one in the shared message
+
+      size_t size() const;
+      std::array<boost::asio::const_buffer, 3> buffers() const;
+    };
+
+    //! Queued object property changed events are conflated by object handle and property name
+    struct ConflationKey
+    {
+      ObjectHandle handle;
+      std::string_view propertyName; //!< points into the queued shared message
+
+      ConflationKey(const WriteItem& item);
+
+      bool operator ==(const ConflationKey& other) const
+      {
+        return handle == other.handle && propertyName == other.propertyName;
+      }
+
+      struct Hash
+      {
+        size_t operator()(const ConflationKey& key) const
+        {
+          return std::hash<std::string_view>()(key.propertyName) ^ (static_cast<size_t>(key.handle) * 0x9E3779B9U);
+        }
+      };
+    };
+
     Server& m_server;
     boost::asio::ip::tcp::socket m_socket;
     struct
@@ -47,8 +87,16 @@ class Connection : public std::enable_shared_from_this<Connection>
       std::shared_ptr<Message> message;
     } m_readBuffer;
     std::mutex m_writeQueueMutex;
-    std::queue<std::unique_ptr<Message>> m_writeQueue;
+    std::deque<WriteItem> m_writeQueue;
+    std::unordered_map<ConflationKey, WriteItem*, ConflationKey::Hash> m_writeQueueConflation; //!< queued object property changed events, excluding the ones being written
+    std::vector<boost::asio::const_buffer> m_writeBuffers; //!< buffers of the messages being written
+    size_t m_writeCount = 0; //!< number of messages being written
+    size_t m_writeBacklog = 0; //!< bytes queued, including the message being written
+    std::atomic<uint32_t> m_writeBacklogStat = 0;
+    bool m_writeBacklogExceeded = false;
     bool m_authenticated;
+    bool m_compression = false; //!< compression enabled, see \ref Message::featureCompression
+    std::vector<uint8_t> m_compressBuffer;
     std::shared_ptr<Session> m_session;
 
     void doReadHeader();
@@ -57,10 +105,31 @@ class Connection : public std::enable_shared_from_this<Connection>
 
     void processMessage(const std::shared_ptr<Message> message);
     void sendMessage(std::unique_ptr<Message> message);
+    void sendMessage(std::shared_ptr<const Message> message, ObjectHandle handle);
+    std::unique_ptr<Message> compress(const Message& message);
+    void queueWrite(WriteItem item);
+    void queueWriteConflated(WriteItem item);
+    void updateWriteBacklog(ptrdiff_t delta);
 
     void connectionLost();
 
   public:
+    //! When more bytes are queued for writing, the client can't keep up and is disconnected.
+    static constexpr size_t writeBacklogMax = 8 * 1024 * 1024;
+
+    inline static std::atomic<uint32_t> conflatedCount = 0; //!< number of object property changed events replaced by a newer one
+    inline static std::atomic<uint32_t> slowClientDisconnectCount = 0; //!< number of connections disconnected due to a write backlog overflow
+
+    //! Messages with more data are sent compressed, if the client supports it.
+    static constexpr size_t compressionThreshold = 1024;
+
+    //! Queued messages are written using a single write up to this number of bytes.
+    static constexpr size_t writeBatchSizeMax = 64 * 1024;
+
+    inline static std::atomic<uint64_t> writeMessageCount = 0; //!< number of messages written
+    inline static std::atomic<uint64_t> writeByteCount = 0; //!< number of bytes written
+    inline static std::atomic<uint64_t> writeSyscallCount = 0; //!< number of socket write operations
+
     const std::string id;
 
     Connection(Server& server, boost::asio::ip::tcp::socket socket, std::string id_);
@@ -69,6 +138,13 @@ class Connection : public std::enable_shared_from_this<Connection>
     void start();
 
     void disconnect();
+
+    //! \brief Number of bytes queued for writing
+    //! \note Thread safe
+    uint32_t writeBacklog() const
+    {
+      return m_writeBacklogStat.load(std::memory_order_relaxed);
+    }
 };
 
 #endif
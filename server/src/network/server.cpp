@@ -140,6 +140,17 @@ void Server::connectionGone(const std::shared_ptr<Connection>& connection)
   m_connections.erase(std::find(m_connections.begin(), m_connections.end(), connection));
 }
 
+std::vector<uint32_t> Server::connectionWriteBacklogs() const
+{
+  assert(isEventLoopThread());
+
+  std::vector<uint32_t> backlogs;
+  backlogs.reserve(m_connections.size());
+  for(const auto& connection : m_connections)
+    backlogs.emplace_back(connection->writeBacklog());
+  return backlogs;
+}
+
 void Server::doReceive()
 {
   assert(IS_SERVER_THREAD);
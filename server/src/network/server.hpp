@@ -27,6 +27,7 @@
 #include <array>
 #include <list>
 #include <thread>
+#include <vector>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
@@ -61,6 +62,9 @@ class Server : public std::enable_shared_from_this<Server>
     Server(bool localhostOnly, uint16_t port, bool discoverable);
     ~Server();
 
+    //! \brief Number of bytes queued for writing, per connection
+    std::vector<uint32_t> connectionWriteBacklogs() const;
+
 #ifndef NDEBUG
     inline auto threadId() const { return m_thread.get_id(); }
 #endif
@@ -21,7 +21,6 @@
  */
 
 #include "session.hpp"
-#include <boost/algorithm/string.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include "../traintastic/traintastic.hpp"
 #include "connection.hpp"
@@ -44,6 +43,42 @@
   #undef GetObject // GetObject is defined by a winapi header
 #endif
 
+static ObjectPtr getObject(std::string_view id)
+{
+  // id is a dot separated path, e.g. world.clock:
+  size_t end = id.find('.');
+  ObjectPtr obj;
+  if(const auto first = id.substr(0, end); first == Traintastic::classId)
+    obj = Traintastic::instance;
+  else if(Traintastic::instance->world)
+    obj = Traintastic::instance->world->getObjectById(std::string(first));
+
+  while(obj && end != std::string_view::npos)
+  {
+    const size_t start = end + 1;
+    end = id.find('.', start);
+    const auto name = id.substr(start, end == std::string_view::npos ? end : end - start);
+
+    if(AbstractProperty* property = obj->getProperty(name); property && property->type() == ValueType::Object)
+      obj = property->toObject();
+    else if(AbstractVectorProperty* vectorProperty = obj->getVectorProperty(name); vectorProperty && vectorProperty->type() == ValueType::Object)
+    {
+      obj = nullptr;
+      const size_t size = vectorProperty->size();
+      for(size_t i = 0; i < size; i++)
+      {
+        ObjectPtr v = vectorProperty->getObject(i);
+        if(id == v->getObjectId())
+          return v;
+      }
+    }
+    else
+      obj = nullptr;
+  }
+
+  return obj;
+}
+
 Session::Session(const std::shared_ptr<Connection>& connection) :
   m_connection{connection},
   m_uuid{boost::uuids::random_generator()()}
@@ -65,43 +100,7 @@ bool Session::processMessage(const Message& message)
   {
     case Message::Command::GetObject:
     {
-      std::string id;
-      message.read(id);
-
-      std::vector<std::string> ids;
-      boost::split(ids, id, [](char c){ return c == '.'; });
-      auto it = ids.cbegin();
-
-      ObjectPtr obj;
-      if(*it == Traintastic::classId)
-        obj = Traintastic::instance;
-      else if(Traintastic::instance->world)
-        obj = Traintastic::instance->world->getObjectById(*it);
-
-      while(obj && ++it != ids.cend())
-      {
-        if(AbstractProperty* property = obj->getProperty(*it); property && property->type() == ValueType::Object)
-          obj = property->toObject();
-        else if(AbstractVectorProperty* vectorProperty = obj->getVectorProperty(*it); vectorProperty && vectorProperty->type() == ValueType::Object)
-        {
-          obj = nullptr;
-          const size_t size = vectorProperty->size();
-          for(size_t i = 0; i < size; i++)
-          {
-            ObjectPtr v = vectorProperty->getObject(i);
-            if(id == v->getObjectId())
-            {
-              obj = v;
-              it++;
-              break;
-            }
-          }
-        }
-        else
-          obj = nullptr;
-      }
-
-      if(obj)
+      if(ObjectPtr obj = getObject(message.read<std::string_view>()))
       {
         auto response = Message::newResponse(message.command(), message.requestId());
         writeObject(*response, obj);
@@ -113,6 +112,25 @@ bool Session::processMessage(const Message& message)
       }
       return true;
     }
+    case Message::Command::GetObjects:
+    {
+      // unknown objects don't fail the request, the client receives a null object instead:
+      const auto count = message.read<Message::Length>();
+      auto response = Message::newResponse(message.command(), message.requestId());
+      response->write(count);
+      for(Message::Length i = 0; i < count; i++)
+      {
+        if(ObjectPtr obj = getObject(message.read<std::string_view>()))
+        {
+          response->write(true);
+          writeObject(*response, obj);
+        }
+        else
+          response->write(false);
+      }
+      m_connection->sendMessage(std::move(response));
+      return true;
+    }
     case Message::Command::ReleaseObject:
     {
       // client counter value must match server counter value,
@@ -123,6 +141,7 @@ bool Session::processMessage(const Message& message)
       if(counter == m_handles.getCounter(handle))
       {
         m_handles.removeHandle(handle);
+        m_boardViewports.erase(handle);
 
         auto it = m_objectSignals.find(handle);
         while(it != m_objectSignals.end())
@@ -144,7 +163,7 @@ bool Session::processMessage(const Message& message)
       {
         if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
         {
-          if(AbstractProperty* property = object->getProperty(message.read<std::string>()); property && !property->isInternal())
+          if(AbstractProperty* property = object->getProperty(message.read<std::string_view>()); property && !property->isInternal())
           {
             try
             {
@@ -199,7 +218,7 @@ bool Session::processMessage(const Message& message)
     {
       if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
       {
-        if(AbstractUnitProperty* property = dynamic_cast<AbstractUnitProperty*>(object->getProperty(message.read<std::string>())); property && !property->isInternal())
+        if(AbstractUnitProperty* property = dynamic_cast<AbstractUnitProperty*>(object->getProperty(message.read<std::string_view>())); property && !property->isInternal())
         {
           try
           {
@@ -219,7 +238,7 @@ bool Session::processMessage(const Message& message)
       {
         if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
         {
-          if(auto* property = object->getObjectProperty(message.read<std::string>()); property && !property->isInternal())
+          if(auto* property = object->getObjectProperty(message.read<std::string_view>()); property && !property->isInternal())
           {
             if(auto obj = property->toObject())
             {
@@ -245,7 +264,7 @@ bool Session::processMessage(const Message& message)
       {
         if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
         {
-          if(auto* property = object->getVectorProperty(message.read<std::string>()); property && !property->isInternal())
+          if(auto* property = object->getVectorProperty(message.read<std::string_view>()); property && !property->isInternal())
           {
             const size_t startIndex = message.read<uint32_t>();
             const size_t endIndex = message.read<uint32_t>();
@@ -274,11 +293,11 @@ bool Session::processMessage(const Message& message)
     {
       if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
       {
-        if(AbstractObjectProperty* property = dynamic_cast<AbstractObjectProperty*>(object->getProperty(message.read<std::string>())); property && !property->isInternal())
+        if(AbstractObjectProperty* property = dynamic_cast<AbstractObjectProperty*>(object->getProperty(message.read<std::string_view>())); property && !property->isInternal())
         {
           try
           {
-            const std::string id = message.read<std::string>();
+            const std::string_view id = message.read<std::string_view>();
             if(!id.empty())
             {
               if(ObjectPtr obj = Traintastic::instance->world->getObjectByPath(id))
@@ -302,7 +321,7 @@ bool Session::processMessage(const Message& message)
     {
       if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
       {
-        if(AbstractMethod* method = object->getMethod(message.read<std::string>()); method && !method->isInternal())
+        if(AbstractMethod* method = object->getMethod(message.read<std::string_view>()); method && !method->isInternal())
         {
           const ValueType resultType = message.read<ValueType>();
           const uint8_t argumentCount = message.read<uint8_t>();
@@ -458,12 +477,25 @@ bool Session::processMessage(const Message& message)
               event->write(region.rowMax);
 
               for(uint32_t row = region.rowMin; row <= region.rowMax; row++)
+              {
+                event->write(tableModel->getRowId(row));
                 for(uint32_t column = region.columnMin; column <= region.columnMax; column++)
                   event->write(tableModel->getText(column, row));
+              }
 
               m_connection->sendMessage(std::move(event));
             };
 
+          model->rowsChangedIncremental = [this](const TableModelPtr& tableModel, TableModelRowChange change, uint32_t row, uint32_t value)
+            {
+              auto event = Message::newEvent(Message::Command::TableModelRowsChanged);
+              event->write(m_handles.getHandle(std::dynamic_pointer_cast<Object>(tableModel)));
+              event->write(change);
+              event->write(row);
+              event->write(value);
+              m_connection->sendMessage(std::move(event));
+            };
+
           return true;
         }
       }
@@ -488,6 +520,18 @@ bool Session::processMessage(const Message& message)
       }
       break;
     }
+    case Message::Command::TableModelSetSortFilter:
+    {
+      TableModelPtr model = std::dynamic_pointer_cast<TableModel>(m_handles.getItem(message.read<Handle>()));
+      if(model)
+      {
+        const auto column = message.read<uint32_t>();
+        const auto descending = message.read<bool>();
+        const auto filter = message.read<std::string_view>();
+        model->setSortFilter(column, descending, filter);
+      }
+      break;
+    }
     case Message::Command::InputMonitorGetInputInfo:
     {
       auto inputMonitor = std::dynamic_pointer_cast<InputMonitor>(m_handles.getItem(message.read<Handle>()));
@@ -543,16 +587,38 @@ bool Session::processMessage(const Message& message)
       if(board)
       {
         auto response = Message::newResponse(message.command(), message.requestId());
-        for(const auto& it : board->tileMap())
+        board->tiles().forEach(
+          [this, &response](const std::shared_ptr<Tile>& tile)
+          {
+            writeTile(*response, tile);
+          });
+        m_connection->sendMessage(std::move(response));
+        return true;
+      }
+      break;
+    }
+    case Message::Command::BoardSetViewport:
+    {
+      const auto handle = message.read<Handle>();
+      if(std::dynamic_pointer_cast<Board>(m_handles.getItem(handle)))
+        m_boardViewports[handle] = message.read<TileChunkRect>();
+      break;
+    }
+    case Message::Command::BoardGetTileChunks:
+    {
+      auto board = std::dynamic_pointer_cast<Board>(m_handles.getItem(message.read<Handle>()));
+      if(board)
+      {
+        const auto& tiles = board->tiles();
+        auto response = Message::newResponse(message.command(), message.requestId());
+        const auto count = message.read<uint32_t>();
+        for(uint32_t i = 0; i < count; i++)
         {
-          const Tile& tile = *(it.second);
-          if(it.first != tile.location()) // only tiles at origin
-            continue;
-          response->write(tile.location());
-          response->write(tile.data());
-          assert(tile.data().isActive() == isActive(tile.data().id()));
-          if(tile.data().isActive())
-            writeObject(*response, it.second);
+          tiles.forEach(message.read<TileChunk>(),
+            [this, &response](const std::shared_ptr<Tile>& tile)
+            {
+              writeTile(*response, tile);
+            });
         }
         m_connection->sendMessage(std::move(response));
         return true;
@@ -815,6 +881,15 @@ void Session::writeTableModel(Message& message, const TableModelPtr& model)
   message.writeBlockEnd(); // end model
 }
 
+void Session::writeTile(Message& message, const std::shared_ptr<Tile>& tile)
+{
+  message.write(tile->location());
+  message.write(tile->data());
+  assert(tile->data().isActive() == isActive(tile->data().id()));
+  if(tile->data().isActive())
+    writeObject(message, tile);
+}
+
 void Session::memoryLoggerChanged(const MemoryLogger& logger, const uint32_t added, const uint32_t removed)
 {
   auto event = Message::newEvent(Message::Command::ServerLog);
@@ -842,6 +917,7 @@ void Session::objectDestroying(Object& object)
   const auto handle = m_handles.getHandle(object.shared_from_this());
   m_handles.removeHandle(handle);
   m_objectSignals.erase(handle);
+  m_boardViewports.erase(handle);
 
   auto event = Message::newEvent(Message::Command::ObjectDestroyed, sizeof(Handle));
   event->write(handle);
@@ -853,23 +929,50 @@ void Session::objectPropertyChanged(BaseProperty& baseProperty)
   if(baseProperty.isInternal())
     return;
 
+  m_connection->sendMessage(sharedObjectPropertyChangedEvent(baseProperty), m_handles.getHandle(baseProperty.object().shared_from_this()));
+}
+
+std::unique_ptr<Message> Session::newObjectPropertyChangedEvent(Handle handle, const BaseProperty& baseProperty)
+{
   auto event = Message::newEvent(Message::Command::ObjectPropertyChanged);
-  event->write(m_handles.getHandle(baseProperty.object().shared_from_this()));
+  event->write(handle);
   event->write(baseProperty.name());
   event->write(baseProperty.type());
-  if(AbstractProperty* property = dynamic_cast<AbstractProperty*>(&baseProperty))
+  if(const AbstractProperty* property = dynamic_cast<const AbstractProperty*>(&baseProperty))
   {
     writePropertyValue(*event, *property);
 
-    if(AbstractUnitProperty* unitProperty = dynamic_cast<AbstractUnitProperty*>(property))
+    if(const AbstractUnitProperty* unitProperty = dynamic_cast<const AbstractUnitProperty*>(property))
       event->write(unitProperty->unitValue());
   }
-  else if(AbstractVectorProperty* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&baseProperty))
+  else if(const AbstractVectorProperty* vectorProperty = dynamic_cast<const AbstractVectorProperty*>(&baseProperty))
     writeVectorPropertyValue(*event, *vectorProperty);
   else
     assert(false);
 
-  m_connection->sendMessage(std::move(event));
+  return event;
+}
+
+std::shared_ptr<const Message> Session::sharedObjectPropertyChangedEvent(const BaseProperty& property)
+{
+  assert(isEventLoopThread());
+
+  // All sessions receive the change in the same propertyChanged signal emit, so the last encoded
+  // event can be reused as long as no other property has changed in between:
+  static struct
+  {
+    const BaseProperty* property = nullptr;
+    uint64_t changeCounter = 0;
+    std::shared_ptr<const Message> event;
+  } cache;
+
+  if(cache.property != &property || cache.changeCounter != BaseProperty::changeCounter() || !cache.event)
+  {
+    cache.property = &property;
+    cache.changeCounter = BaseProperty::changeCounter();
+    cache.event = newObjectPropertyChangedEvent(Handles::invalidHandle, property);
+  }
+  return cache.event;
 }
 
 void Session::writePropertyValue(Message& message , const AbstractProperty& property)
@@ -1122,8 +1225,12 @@ void Session::outputKeyboardOutputValueChanged(OutputKeyboard& outputKeyboard, c
 
 void Session::boardTileDataChanged(Board& board, const TileLocation& location, const TileData& data)
 {
+  const auto handle = m_handles.getHandle(board.shared_from_this());
+  if(auto it = m_boardViewports.find(handle); it != m_boardViewports.end() && !it->second.contains(location))
+    return; // not visible for client, it gets the tile when the chunk becomes visible
+
   auto event = Message::newEvent(Message::Command::BoardTileDataChanged);
-  event->write(m_handles.getHandle(board.shared_from_this()));
+  event->write(handle);
   event->write(location);
   event->write(data);
   assert(data.isActive() == isActive(data.id()));
@@ -28,6 +28,7 @@
 #include <boost/signals2/connection.hpp>
 #include <traintastic/network/message.hpp>
 #include <traintastic/enum/tristate.hpp>
+#include <traintastic/board/tilechunk.hpp>
 #include "handlelist.hpp"
 #include "../core/objectptr.hpp"
 #include "../core/tablemodelptr.hpp"
@@ -45,8 +46,7 @@ class OutputKeyboard;
 class Board;
 class OutputMap;
 struct TypeInfo;
-struct TileLocation;
-struct TileData;
+class Tile;
 
 class Session : public std::enable_shared_from_this<Session>
 {
@@ -68,10 +68,12 @@ class Session : public std::enable_shared_from_this<Session>
     boost::uuids::uuid m_uuid;
     Handles m_handles;
     std::unordered_multimap<Handle, boost::signals2::connection> m_objectSignals;
+    std::unordered_map<Handle, TileChunkRect> m_boardViewports; //!< only boards with a viewport set, others receive all changes
 
     bool processMessage(const Message& message);
 
     void writeObject(Message& message, const ObjectPtr& object);
+    void writeTile(Message& message, const std::shared_ptr<Tile>& tile);
     void writeTableModel(Message& message, const TableModelPtr& model);
 
     void memoryLoggerChanged(const MemoryLogger& logger, uint32_t added, uint32_t removed);
@@ -92,6 +94,21 @@ class Session : public std::enable_shared_from_this<Session>
     void outputMapOutputsChanged(OutputMap& outputMap);
 
   public:
+    /**
+     * \brief Create object property changed event
+     */
+    static std::unique_ptr<Message> newObjectPropertyChangedEvent(Handle handle, const BaseProperty& property);
+
+    /**
+     * \brief Get object property changed event shared by all sessions
+     *
+     * The event is encoded only once per property change and has an invalid object handle,
+     * the object handle must be replaced by the session's handle when sending it.
+     *
+     * \note This function must run in the event loop thread.
+     */
+    static std::shared_ptr<const Message> sharedObjectPropertyChangedEvent(const BaseProperty& property);
+
     Session(const std::shared_ptr<Connection>& connection);
     ~Session();
 
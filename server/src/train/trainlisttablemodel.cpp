@@ -95,6 +95,28 @@ std::string TrainListTableModel::getText(uint32_t column, uint32_t row) const
   return "";
 }
 
+TableModel::SortKey TrainListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount())
+  {
+    const Train& train = getItem(row);
+
+    switch(column)
+    {
+      case columnActive:
+        return train.active ? 1. : 0.;
+
+      case columnLength:
+        return train.lob.getValue(LengthUnit::Meter);
+
+      case columnWeight:
+        return train.weight.getValue(WeightUnit::Ton);
+    }
+  }
+
+  return getText(column, row);
+}
+
 void TrainListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   if(property.name() == "id")
@@ -43,6 +43,7 @@ class TrainListTableModel : public ObjectListTableModel<Train>
     TrainListTableModel(TrainList& list);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 #endif
@@ -0,0 +1,140 @@
+/**
+ * server/src/traintastic/diagnostics.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "diagnostics.hpp"
+#include "../core/attributes.hpp"
+#include "../core/eventloop.hpp"
+#include "../network/connection.hpp"
+#include "../network/server.hpp"
+#include "traintastic.hpp"
+#include "../utils/category.hpp"
+
+constexpr auto diagnosticsPropertyFlags = PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly;
+
+static std::vector<uint32_t> toVector(const EventLoopStatistics::Histogram& histogram)
+{
+  return {histogram.begin(), histogram.end()};
+}
+
+Diagnostics::Diagnostics()
+  : m_updateTimer{EventLoop::ioContext}
+  , eventLoopQueueDepth{this, "event_loop_queue_depth", 0, diagnosticsPropertyFlags}
+  , eventLoopQueueDepthMax{this, "event_loop_queue_depth_max", 0, diagnosticsPropertyFlags}
+  , eventLoopHandled{this, "event_loop_handled", 0, diagnosticsPropertyFlags}
+  , eventLoopLatencyMax{this, "event_loop_latency_max", 0, diagnosticsPropertyFlags}
+  , eventLoopExecutionTimeMax{this, "event_loop_execution_time_max", 0, diagnosticsPropertyFlags}
+  , eventLoopLatencyHistogram{*this, "event_loop_latency_histogram", {}, diagnosticsPropertyFlags}
+  , eventLoopExecutionTimeHistogram{*this, "event_loop_execution_time_histogram", {}, diagnosticsPropertyFlags}
+  , eventLoopStalls{this, "event_loop_stalls", 0, diagnosticsPropertyFlags}
+  , connectionWriteBacklog{*this, "connection_write_backlog", {}, diagnosticsPropertyFlags}
+  , connectionWriteConflated{this, "connection_write_conflated", 0, diagnosticsPropertyFlags}
+  , connectionSlowClientDisconnects{this, "connection_slow_client_disconnects", 0, diagnosticsPropertyFlags}
+  , connectionWriteSyscalls{this, "connection_write_syscalls", 0, diagnosticsPropertyFlags}
+  , connectionWriteBytesPerSyscall{this, "connection_write_bytes_per_syscall", 0, diagnosticsPropertyFlags}
+  , connectionWriteMessagesPerSyscall{this, "connection_write_messages_per_syscall", 0, diagnosticsPropertyFlags}
+{
+  Attributes::addCategory(eventLoopQueueDepth, Category::eventLoop);
+  m_interfaceItems.add(eventLoopQueueDepth);
+  Attributes::addCategory(eventLoopQueueDepthMax, Category::eventLoop);
+  m_interfaceItems.add(eventLoopQueueDepthMax);
+  Attributes::addCategory(eventLoopHandled, Category::eventLoop);
+  m_interfaceItems.add(eventLoopHandled);
+  Attributes::addCategory(eventLoopLatencyMax, Category::eventLoop);
+  m_interfaceItems.add(eventLoopLatencyMax);
+  Attributes::addCategory(eventLoopExecutionTimeMax, Category::eventLoop);
+  m_interfaceItems.add(eventLoopExecutionTimeMax);
+  Attributes::addCategory(eventLoopLatencyHistogram, Category::eventLoop);
+  m_interfaceItems.add(eventLoopLatencyHistogram);
+  Attributes::addCategory(eventLoopExecutionTimeHistogram, Category::eventLoop);
+  m_interfaceItems.add(eventLoopExecutionTimeHistogram);
+  Attributes::addCategory(eventLoopStalls, Category::eventLoop);
+  m_interfaceItems.add(eventLoopStalls);
+  Attributes::addCategory(connectionWriteBacklog, Category::network);
+  m_interfaceItems.add(connectionWriteBacklog);
+  Attributes::addCategory(connectionWriteConflated, Category::network);
+  m_interfaceItems.add(connectionWriteConflated);
+  Attributes::addCategory(connectionSlowClientDisconnects, Category::network);
+  m_interfaceItems.add(connectionSlowClientDisconnects);
+  Attributes::addCategory(connectionWriteSyscalls, Category::network);
+  m_interfaceItems.add(connectionWriteSyscalls);
+  Attributes::addCategory(connectionWriteBytesPerSyscall, Category::network);
+  m_interfaceItems.add(connectionWriteBytesPerSyscall);
+  Attributes::addCategory(connectionWriteMessagesPerSyscall, Category::network);
+  m_interfaceItems.add(connectionWriteMessagesPerSyscall);
+
+  update();
+  startUpdateTimer();
+}
+
+void Diagnostics::destroying()
+{
+  m_updateTimer.cancel();
+  Object::destroying();
+}
+
+void Diagnostics::startUpdateTimer()
+{
+  m_updateTimer.expires_after(updateInterval);
+  m_updateTimer.async_wait(
+    [this](const boost::system::error_code& ec)
+    {
+      if(ec)
+        return;
+
+      update();
+      startUpdateTimer();
+    });
+}
+
+void Diagnostics::update()
+{
+  const auto& statistics = EventLoop::statistics;
+
+  eventLoopQueueDepth.setValueInternal(statistics.queueDepth());
+  eventLoopQueueDepthMax.setValueInternal(statistics.queueDepthMax());
+  eventLoopHandled.setValueInternal(statistics.handledCount());
+  eventLoopLatencyMax.setValueInternal(static_cast<uint32_t>(statistics.latencyMax().count()));
+  eventLoopExecutionTimeMax.setValueInternal(static_cast<uint32_t>(statistics.executionTimeMax().count()));
+  eventLoopLatencyHistogram.setValuesInternal(toVector(statistics.latencyHistogram()));
+  eventLoopExecutionTimeHistogram.setValuesInternal(toVector(statistics.executionTimeHistogram()));
+  eventLoopStalls.setValueInternal(statistics.stalls());
+
+  if(Traintastic::instance && Traintastic::instance->server())
+    connectionWriteBacklog.setValuesInternal(Traintastic::instance->server()->connectionWriteBacklogs());
+  else
+    connectionWriteBacklog.setValuesInternal({});
+  connectionWriteConflated.setValueInternal(Connection::conflatedCount.load(std::memory_order_relaxed));
+  connectionSlowClientDisconnects.setValueInternal(Connection::slowClientDisconnectCount.load(std::memory_order_relaxed));
+
+  const uint64_t writeSyscalls = Connection::writeSyscallCount.load(std::memory_order_relaxed);
+  connectionWriteSyscalls.setValueInternal(static_cast<uint32_t>(writeSyscalls));
+  if(writeSyscalls != 0)
+  {
+    connectionWriteBytesPerSyscall.setValueInternal(static_cast<uint32_t>(Connection::writeByteCount.load(std::memory_order_relaxed) / writeSyscalls));
+    connectionWriteMessagesPerSyscall.setValueInternal(static_cast<double>(Connection::writeMessageCount.load(std::memory_order_relaxed)) / writeSyscalls);
+  }
+  else
+  {
+    connectionWriteBytesPerSyscall.setValueInternal(0);
+    connectionWriteMessagesPerSyscall.setValueInternal(0);
+  }
+}
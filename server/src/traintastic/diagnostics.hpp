@@ -0,0 +1,72 @@
+/**
+ * server/src/traintastic/diagnostics.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_TRAINTASTIC_DIAGNOSTICS_HPP
+#define TRAINTASTIC_SERVER_TRAINTASTIC_DIAGNOSTICS_HPP
+
+#include "../core/object.hpp"
+#include <boost/asio/steady_timer.hpp>
+#include "../core/property.hpp"
+#include "../core/vectorproperty.hpp"
+
+//! \brief Read-only server diagnostics
+//! Values are sampled periodically, not on every change, to prevent the diagnostics from loading the event loop.
+//! Counters and maximums are kept since server start, they can't be reset by clients or scripts.
+class Diagnostics final : public Object
+{
+  private:
+    static constexpr std::chrono::seconds updateInterval{1};
+
+    boost::asio::steady_timer m_updateTimer;
+
+    void startUpdateTimer();
+    void update();
+
+  protected:
+    void destroying() final;
+
+  public:
+    CLASS_ID("diagnostics")
+
+    static constexpr std::string_view id = classId;
+
+    Property<uint32_t> eventLoopQueueDepth;
+    Property<uint32_t> eventLoopQueueDepthMax;
+    Property<uint32_t> eventLoopHandled;
+    Property<uint32_t> eventLoopLatencyMax;
+    Property<uint32_t> eventLoopExecutionTimeMax;
+    VectorProperty<uint32_t> eventLoopLatencyHistogram;
+    VectorProperty<uint32_t> eventLoopExecutionTimeHistogram;
+    Property<uint32_t> eventLoopStalls;
+    VectorProperty<uint32_t> connectionWriteBacklog;
+    Property<uint32_t> connectionWriteConflated;
+    Property<uint32_t> connectionSlowClientDisconnects;
+    Property<uint32_t> connectionWriteSyscalls;
+    Property<uint32_t> connectionWriteBytesPerSyscall;
+    Property<double> connectionWriteMessagesPerSyscall;
+
+    Diagnostics();
+
+    std::string getObjectId() const final { return std::string(id); }
+};
+
+#endif
@@ -24,8 +24,10 @@
 #include <fstream>
 #include <iomanip>
 #include "../core/attributes.hpp"
+#include "../core/eventloop.hpp"
 #include "traintastic.hpp"
 #include "../network/server.hpp"
+#include "../hardware/protocol/kernelthreadpool.hpp"
 #include "../log/log.hpp"
 #include "../os/localtime.hpp"
 #include "../utils/category.hpp"
@@ -55,10 +57,35 @@ Settings::Settings(const std::filesystem::path& path)
   , loadLastWorldOnStartup{this, "load_last_world_on_startup", true, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , autoSaveWorldOnExit{this, "auto_save_world_on_exit", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , saveWorldUncompressed{this, "save_world_uncompressed", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
+  , saveWorldBinary{this, "save_world_binary", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , allowClientServerRestart{this, "allow_client_server_restart", false, PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const bool& /*value*/){ saveToFile(); }}
   , allowClientServerShutdown{this, "allow_client_server_shutdown", false, PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const bool& /*value*/){ saveToFile(); }}
   , memoryLoggerSize{this, Name::memoryLoggerSize, Default::memoryLoggerSize, PropertyFlags::ReadWrite, [this](const uint32_t& /*value*/){ saveToFile(); }}
   , enableFileLogger{this, Name::enableFileLogger, Default::enableFileLogger, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
+  , eventLoopStallThreshold{this, Name::eventLoopStallThreshold, Default::eventLoopStallThreshold, PropertyFlags::ReadWrite,
+      [this](const uint32_t& value)
+      {
+        EventLoop::statistics.stallThreshold = std::chrono::milliseconds(value);
+        saveToFile();
+      }}
+  , kernelThreadPool{this, Name::kernelThreadPool, Default::kernelThreadPool, PropertyFlags::ReadWrite,
+      [this](const bool& value)
+      {
+        KernelThreadPool::config.enabled = value;
+        saveToFile();
+      }}
+  , kernelThreadPoolSize{this, Name::kernelThreadPoolSize, Default::kernelThreadPoolSize, PropertyFlags::ReadWrite,
+      [this](const uint32_t& value)
+      {
+        KernelThreadPool::config.threadCount = value;
+        saveToFile();
+      }}
+  , kernelThreadPoolPinThreads{this, Name::kernelThreadPoolPinThreads, Default::kernelThreadPoolPinThreads, PropertyFlags::ReadWrite,
+      [this](const bool& value)
+      {
+        KernelThreadPool::config.pinThreads = value;
+        saveToFile();
+      }}
 {
   m_interfaceItems.add(lastWorld);
   m_interfaceItems.add(loadLastWorldOnStartup);
@@ -83,8 +110,25 @@ Settings::Settings(const std::filesystem::path& path)
 
   Attributes::addCategory(saveWorldUncompressed, Category::developer);
   m_interfaceItems.add(saveWorldUncompressed);
+  Attributes::addCategory(saveWorldBinary, Category::developer);
+  m_interfaceItems.add(saveWorldBinary);
+  Attributes::addCategory(eventLoopStallThreshold, Category::developer);
+  Attributes::addMinMax(eventLoopStallThreshold, 0U, eventLoopStallThresholdMax);
+  m_interfaceItems.add(eventLoopStallThreshold);
+  Attributes::addCategory(kernelThreadPool, Category::developer);
+  m_interfaceItems.add(kernelThreadPool);
+  Attributes::addCategory(kernelThreadPoolSize, Category::developer);
+  Attributes::addMinMax(kernelThreadPoolSize, 1U, KernelThreadPool::threadCountMax);
+  m_interfaceItems.add(kernelThreadPoolSize);
+  Attributes::addCategory(kernelThreadPoolPinThreads, Category::developer);
+  m_interfaceItems.add(kernelThreadPoolPinThreads);
 
   loadFromFile();
+
+  EventLoop::statistics.stallThreshold = std::chrono::milliseconds(eventLoopStallThreshold.value());
+  KernelThreadPool::config.enabled = kernelThreadPool;
+  KernelThreadPool::config.threadCount = kernelThreadPoolSize;
+  KernelThreadPool::config.pinThreads = kernelThreadPoolPinThreads;
 }
 
 void Settings::loadFromFile()
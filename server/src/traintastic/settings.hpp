@@ -32,17 +32,26 @@ class Settings : public Object
   private:
     static constexpr std::string_view filename = "settings.json";
     static constexpr uint32_t memoryLoggerSizeMax = 1'000'000;
+    static constexpr uint32_t eventLoopStallThresholdMax = 60'000; //!< ms
 
     struct Name
     {
       static constexpr const char* memoryLoggerSize = "memory_logger_size";
       static constexpr const char* enableFileLogger = "enable_file_logger";
+      static constexpr const char* eventLoopStallThreshold = "event_loop_stall_threshold";
+      static constexpr const char* kernelThreadPool = "kernel_thread_pool";
+      static constexpr const char* kernelThreadPoolSize = "kernel_thread_pool_size";
+      static constexpr const char* kernelThreadPoolPinThreads = "kernel_thread_pool_pin_threads";
     };
 
     struct Default
     {
       static constexpr uint32_t memoryLoggerSize = 1000;
       static constexpr bool enableFileLogger = false;
+      static constexpr uint32_t eventLoopStallThreshold = 100; //!< ms
+      static constexpr bool kernelThreadPool = false; //!< experimental, see \ref KernelThreadPool
+      static constexpr uint32_t kernelThreadPoolSize = 2;
+      static constexpr bool kernelThreadPoolPinThreads = false;
     };
 
     const std::filesystem::path m_filename;
@@ -70,10 +79,15 @@ class Settings : public Object
     Property<bool> loadLastWorldOnStartup;
     Property<bool> autoSaveWorldOnExit;
     Property<bool> saveWorldUncompressed;
+    Property<bool> saveWorldBinary;
     Property<bool> allowClientServerRestart;
     Property<bool> allowClientServerShutdown;
     Property<uint32_t> memoryLoggerSize;
     Property<bool> enableFileLogger;
+    Property<uint32_t> eventLoopStallThreshold;
+    Property<bool> kernelThreadPool;
+    Property<uint32_t> kernelThreadPoolSize;
+    Property<bool> kernelThreadPoolPinThreads;
 
     Settings(const std::filesystem::path& path);
 
@@ -72,6 +72,7 @@ Traintastic::Traintastic(const std::filesystem::path& dataDir) :
   m_signalSet(EventLoop::ioContext),
   about{this, "about", std::string(versionCopyrightAndLicense), PropertyFlags::ReadOnly},
   settings{this, "settings", nullptr, PropertyFlags::ReadWrite/*ReadOnly*/},
+  diagnostics{this, "diagnostics", nullptr, PropertyFlags::ReadOnly},
   version{this, "version", TRAINTASTIC_VERSION_FULL, PropertyFlags::ReadOnly},
   world{this, "world", nullptr, PropertyFlags::ReadWrite,
     [this](const std::shared_ptr<World>& /*newWorld*/)
@@ -155,6 +156,7 @@ Traintastic::Traintastic(const std::filesystem::path& dataDir) :
 
   m_interfaceItems.add(about);
   m_interfaceItems.add(settings);
+  m_interfaceItems.add(diagnostics);
   m_interfaceItems.add(version);
   m_interfaceItems.add(world);
   m_interfaceItems.add(worldList);
@@ -202,6 +204,7 @@ Traintastic::RunStatus Traintastic::run(const std::string& worldUUID, bool simul
   Log::log(*this, LogMessage::I9002_X, Lua::getVersion());
 
   settings = std::make_shared<Settings>(m_dataDir);
+  diagnostics.setValueInternal(std::make_shared<Diagnostics>());
   Attributes::setEnabled(restart, settings->allowClientServerRestart);
   Attributes::setEnabled(shutdown, settings->allowClientServerShutdown);
 
@@ -33,6 +33,7 @@
 #include "../core/objectproperty.hpp"
 #include "../core/method.hpp"
 #include "settings.hpp"
+#include "diagnostics.hpp"
 #include "../world/world.hpp"
 #include "../world/worldlist.hpp"
 
@@ -72,6 +73,7 @@ class Traintastic final : public Object
 
     Property<std::string> about;
     ObjectProperty<Settings> settings;
+    ObjectProperty<Diagnostics> diagnostics;
     Property<std::string> version;
     ObjectProperty<World> world;
     ObjectProperty<WorldList> worldList;
@@ -86,6 +88,8 @@ class Traintastic final : public Object
 
     std::string getObjectId() const final { return std::string(id); }
 
+    const std::shared_ptr<Server>& server() const { return m_server; }
+
     const std::filesystem::path& dataDir() const { return m_dataDir; }
     std::filesystem::path dataBackupDir() const { return m_dataDir / ".backup"; }
 
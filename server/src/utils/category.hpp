@@ -29,6 +29,7 @@ namespace Category
 {
   constexpr std::string_view cargo = "category:cargo";
   constexpr std::string_view developer = "category:developer";
+  constexpr std::string_view eventLoop = "category:event_loop";
   constexpr std::string_view info = "category:info";
   constexpr std::string_view log = "category:log";
   constexpr std::string_view network = "category:network";
@@ -0,0 +1,48 @@
+/**
+ * server/src/utils/setthreadaffinity.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "setthreadaffinity.hpp"
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#elif defined(WIN32)
+  #include <windows.h>
+#endif
+
+bool setThreadAffinity(unsigned int cpu)
+{
+#if defined(__linux__)
+  if(cpu >= CPU_SETSIZE)
+    return false;
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(cpu, &cpuSet);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#elif defined(WIN32)
+  if(cpu >= sizeof(DWORD_PTR) * 8)
+    return false;
+  return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu) != 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
@@ -25,10 +25,23 @@
 
 namespace ZLib {
 
+size_t compressBound(size_t srcSize)
+{
+  return ::compressBound(static_cast<uLong>(srcSize));
+}
+
+bool compress(const void* src, size_t srcSize, void* dst, size_t& dstSize, int level)
+{
+  uLongf destLen = dstSize;
+  const int r = compress2(reinterpret_cast<Bytef*>(dst), &destLen, reinterpret_cast<const Bytef*>(src), srcSize, level);
+  dstSize = destLen;
+  return r == Z_OK;
+}
+
 bool compressString(std::string_view src, std::vector<std::byte>& out)
 {
   uLongf destLen = out.size();
-  const int r = compress(reinterpret_cast<Bytef*>(out.data()), &destLen, reinterpret_cast<const Bytef*>(src.data()), src.size());
+  const int r = ::compress(reinterpret_cast<Bytef*>(out.data()), &destLen, reinterpret_cast<const Bytef*>(src.data()), src.size());
   out.resize(destLen);
   return r == Z_OK;
 }
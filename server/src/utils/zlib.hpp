@@ -30,6 +30,14 @@
 
 namespace ZLib {
 
+//! \brief Maximum size of \p srcSize bytes compressed
+size_t compressBound(size_t srcSize);
+
+//! \brief Compress \p src into \p dst
+//! \param[in,out] dstSize Size of \p dst, set to the compressed size
+//! \param[in] level Compression level, 1 (fastest) to 9 (best), -1 for the default
+bool compress(const void* src, size_t srcSize, void* dst, size_t& dstSize, int level = -1);
+
 bool compressString(std::string_view src, std::vector<std::byte>& out);
 
 namespace Uncompress {
@@ -77,6 +77,14 @@ std::string RailVehicleListTableModel::getText(uint32_t column, uint32_t row) co
   return "";
 }
 
+TableModel::SortKey RailVehicleListTableModel::getSortKey(uint32_t column, uint32_t row) const
+{
+  if(row < rowCount() && column == columnLOB)
+    return getItem(row).lob.getValue(LengthUnit::Meter);
+
+  return getText(column, row);
+}
+
 void RailVehicleListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   if(property.name() == "id")
@@ -43,6 +43,7 @@ class RailVehicleListTableModel : public ObjectListTableModel<RailVehicle>
     RailVehicleListTableModel(ObjectList<RailVehicle>& list);
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    SortKey getSortKey(uint32_t column, uint32_t row) const final;
 };
 
 #endif
@@ -21,94 +21,223 @@
  */
 
 #include "ctwreader.hpp"
+#include <algorithm>
+#include <istream>
+#include <utility>
 #include <archive.h>
 #include <archive_entry.h>
 #include "libarchiveerror.hpp"
+#include "world.hpp"
+#include "../utils/startswith.hpp"
 
 using nlohmann::json;
 
-CTWReader::CTWReader() :
-  m_archive{archive_read_new(),
+class CTWReader::EntryBuffer : public std::streambuf
+{
+  private:
+    archive* m_archive;
+    char m_buffer[16 * 1024];
+
+  protected:
+    int_type underflow() final
+    {
+      const auto count = archive_read_data(m_archive, m_buffer, sizeof(m_buffer));
+      if(count < 0)
+        throw LibArchiveError(m_archive);
+      if(count == 0)
+        return traits_type::eof();
+      setg(m_buffer, m_buffer, m_buffer + count);
+      return traits_type::to_int_type(*gptr());
+    }
+
+  public:
+    EntryBuffer(archive* a)
+      : m_archive{a}
+    {
+    }
+};
+
+CTWReader::CTWReader(const std::filesystem::path& filename)
+  : m_filename{filename}
+  , m_archive{nullptr, nullptr}
+{
+  open();
+}
+
+CTWReader::CTWReader(const std::vector<std::byte>& memory)
+  : m_memory{&memory}
+  , m_archive{nullptr, nullptr}
+{
+  open();
+}
+
+CTWReader::~CTWReader() = default;
+
+void CTWReader::open()
+{
+  m_archive = {archive_read_new(),
     [](archive* a)
     {
       archive_read_close(a);
       archive_read_free(a);
-    }}
-{
+    }};
+  m_entry = nullptr;
+  m_entryCount = 0;
+  m_eof = false;
+
   if(archive_read_support_filter_xz(m_archive.get()) != ARCHIVE_OK)
     throw LibArchiveError(m_archive.get());
   if(archive_read_support_format_tar(m_archive.get()) != ARCHIVE_OK)
     throw LibArchiveError(m_archive.get());
-}
 
-CTWReader::CTWReader(const std::filesystem::path& filename)
-  : CTWReader()
-{
-  if(archive_read_open_filename(m_archive.get(), filename.string().c_str(), 10240) != ARCHIVE_OK)
+  if(m_memory)
+  {
+    if(archive_read_open_memory(m_archive.get(), m_memory->data(), m_memory->size()) != ARCHIVE_OK)
+      throw LibArchiveError(m_archive.get());
+  }
+  else if(archive_read_open_filename(m_archive.get(), m_filename.string().c_str(), 10240) != ARCHIVE_OK)
     throw LibArchiveError(m_archive.get());
-
-  readFiles();
 }
 
-CTWReader::CTWReader(const std::vector<std::byte>& memory)
-  : CTWReader()
+archive_entry* CTWReader::seek(std::initializer_list<std::string> names)
 {
-  if(archive_read_open_memory(m_archive.get(), memory.data(), memory.size()) != ARCHIVE_OK)
-    throw LibArchiveError(m_archive.get());
+  const auto matches =
+    [&names](const std::string& pathname)
+    {
+      return std::find(names.begin(), names.end(), pathname) != names.end();
+    };
 
-  readFiles();
-}
+  if(m_entry && matches(archive_entry_pathname(m_entry)))
+    return std::exchange(m_entry, nullptr); // data will be consumed
 
-void CTWReader::readFiles()
-{
-  // load everything in memory:
-  archive_entry* entry = nullptr;
+  const auto passed =
+    [this](const std::string& name)
+    {
+      auto it = m_index.find(name);
+      return it != m_index.end() && it->second < m_entryCount;
+    };
+
+  if(std::any_of(names.begin(), names.end(), passed))
+    open(); // start over
+  else if(m_eof)
+    return nullptr;
+
+  m_entry = nullptr;
   while(true)
   {
-    const int r = archive_read_next_header(m_archive.get(), &entry);
+    archive_entry* entry = nullptr;
+    const int r = archive_read_next_header(m_archive.get(), &entry); // skips data of the previous entry
     if(r == ARCHIVE_EOF)
-      break;
+    {
+      m_entry = nullptr;
+      m_eof = true;
+      return nullptr;
+    }
     if(r < ARCHIVE_OK)
       throw LibArchiveError(m_archive.get());
 
-    std::vector<std::byte> data;
-    data.resize(archive_entry_size(entry));
-
-    size_t pos = 0;
-    while(pos < data.size())
+    std::string pathname = archive_entry_pathname(entry);
+    const bool match = matches(pathname);
+    m_index.emplace(std::move(pathname), m_entryCount++);
+    if(match)
     {
-      const auto count = archive_read_data(m_archive.get(), data.data() + pos, data.size() - pos);
-      if(count < 0)
-        throw LibArchiveError(m_archive.get());
-      if(count == 0)
-        break; // should not happen
-      pos += static_cast<size_t>(count);
+      m_entry = nullptr;
+      return entry; // data will be consumed
     }
-
-    if(pos == data.size())
-      m_files.emplace(archive_entry_pathname(entry), std::move(data));
+    m_entry = entry;
   }
+}
 
-  m_archive.reset();
+void CTWReader::read(archive_entry* entry, nlohmann::json& data)
+{
+  EntryBuffer buffer(m_archive.get());
+  std::istream stream(&buffer);
+  if(std::filesystem::path(archive_entry_pathname(entry)).extension() == World::dotCBOR)
+    data = json::from_cbor(stream);
+  else
+    data = json::parse(stream);
 }
 
 bool CTWReader::readFile(const std::filesystem::path& filename, nlohmann::json& data)
 {
-  auto it = m_files.find(filename.string());
-  if(it == m_files.end())
+  archive_entry* entry = seek({filename.generic_string()});
+  if(!entry)
     return false;
+  read(entry, data);
+  return true;
+}
 
-  std::string_view sv{reinterpret_cast<const char*>(it->second.data()), it->second.size()};
-  data = json::parse(sv.begin(), sv.end());
+bool CTWReader::readFile(const std::filesystem::path& filename, const std::filesystem::path& alternativeFilename, nlohmann::json& data, bool* alternative)
+{
+  archive_entry* entry = seek({filename.generic_string(), alternativeFilename.generic_string()});
+  if(!entry)
+    return false;
+  if(alternative)
+    *alternative = (archive_entry_pathname(entry) != filename.generic_string());
+  read(entry, data);
   return true;
 }
 
+void CTWReader::read(archive_entry* entry, std::string& text)
+{
+  text.resize(static_cast<size_t>(archive_entry_size(entry)));
+
+  size_t pos = 0;
+  while(pos < text.size())
+  {
+    const auto count = archive_read_data(m_archive.get(), text.data() + pos, text.size() - pos);
+    if(count < 0)
+      throw LibArchiveError(m_archive.get());
+    if(count == 0)
+      break; // should not happen
+    pos += static_cast<size_t>(count);
+  }
+  text.resize(pos);
+}
+
 bool CTWReader::readFile(const std::filesystem::path& filename, std::string& text)
 {
-  auto it = m_files.find(filename.generic_string());
-  if(it == m_files.end())
+  archive_entry* entry = seek({filename.generic_string()});
+  if(!entry)
     return false;
-
-  text.assign(reinterpret_cast<const char*>(it->second.data()), it->second.size());
+  read(entry, text);
   return true;
 }
+
+void CTWReader::readFiles(const std::filesystem::path& directory, std::unordered_map<std::string, std::string>& files)
+{
+  const std::string prefix = directory.generic_string() + "/";
+
+  const bool passed = std::any_of(m_index.begin(), m_index.end(),
+    [this, &prefix](const auto& it)
+    {
+      return it.second < m_entryCount && startsWith(it.first, prefix);
+    });
+
+  if(passed)
+    open(); // start over
+  else if(m_eof)
+    return;
+
+  archive_entry* entry = std::exchange(m_entry, nullptr);
+  while(true)
+  {
+    if(!entry)
+    {
+      const int r = archive_read_next_header(m_archive.get(), &entry); // skips data of the previous entry
+      if(r == ARCHIVE_EOF)
+      {
+        m_eof = true;
+        return;
+      }
+      if(r < ARCHIVE_OK)
+        throw LibArchiveError(m_archive.get());
+      m_index.emplace(archive_entry_pathname(entry), m_entryCount++);
+    }
+
+    std::string pathname = archive_entry_pathname(entry);
+    if(startsWith(pathname, prefix))
+      read(entry, files[std::move(pathname)]);
+    entry = nullptr;
+  }
+}
@@ -23,6 +23,9 @@
 #ifndef TRAINTASTIC_SERVER_WORLD_CTWREADER_HPP
 #define TRAINTASTIC_SERVER_WORLD_CTWREADER_HPP
 
+#include <initializer_list>
+#include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include <cstddef>
@@ -30,22 +33,51 @@
 #include <nlohmann/json.hpp>
 
 struct archive;
+struct archive_entry;
 
+//! \brief Streaming reader for CTW (xz compressed tar) world archives
+//!
+//! Entries are decompressed only when they are read and JSON is parsed directly from the
+//! decompression stream, nothing is buffered. As the archive can't be seeked, reading an
+//! entry that is already passed reopens the archive. Reading entries in the order they are
+//! written is the most efficient.
 class CTWReader
 {
   private:
+    class EntryBuffer;
+
+    const std::filesystem::path m_filename;
+    const std::vector<std::byte>* m_memory = nullptr;
     std::unique_ptr<archive, void(*)(archive*)> m_archive;
-    std::unordered_map<std::string, std::vector<std::byte>> m_files;
+    archive_entry* m_entry = nullptr; //!< entry of which the data is not read yet
+    std::unordered_map<std::string, size_t> m_index; //!< entry number of passed entries
+    size_t m_entryCount = 0; //!< number of entries passed
+    bool m_eof = false;
 
-    CTWReader();
-    void readFiles();
+    void open();
+    archive_entry* seek(std::initializer_list<std::string> names);
+    void read(archive_entry* entry, nlohmann::json& data);
+    void read(archive_entry* entry, std::string& text);
 
   public:
     CTWReader(const std::filesystem::path& filename);
+    //! \note \a memory must stay valid during the lifetime of the reader
     CTWReader(const std::vector<std::byte>& memory);
+    ~CTWReader();
 
+    //! \brief Read JSON file, CBOR encoded if \a filename has the \ref World::dotCBOR extension
     bool readFile(const std::filesystem::path& filename, nlohmann::json& data);
+
+    //! \brief Read JSON file \a filename or \a alternativeFilename, whichever is found first
+    //! Avoids scanning the complete archive if only one of the files exists.
+    //! \param[out] alternative Set if \a alternativeFilename is read, optional
+    bool readFile(const std::filesystem::path& filename, const std::filesystem::path& alternativeFilename, nlohmann::json& data, bool* alternative = nullptr);
     bool readFile(const std::filesystem::path& filename, std::string& text);
+
+    //! \brief Read all files in \a directory (and its sub directories) in a single pass
+    //! \param[in] directory Directory in the archive
+    //! \param[out] files File contents by filename
+    void readFiles(const std::filesystem::path& directory, std::unordered_map<std::string, std::string>& files);
 };
 
 #endif
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include <archive.h>
 #include <archive_entry.h>
 #include "libarchiveerror.hpp"
+#include "world.hpp"
 
 static int memoryOpenCallback(archive* /*unused*/, void* /*clientData*/)
 {
@@ -78,18 +79,29 @@ CTWWriter::CTWWriter(std::vector<std::byte>& memory)
 
 void CTWWriter::writeFile(const std::filesystem::path& filename, const nlohmann::json& data)
 {
-  writeFile(filename, data.dump());
+  if(filename.extension() == World::dotCBOR)
+  {
+    const auto cbor = nlohmann::json::to_cbor(data);
+    writeFile(filename, cbor.data(), cbor.size());
+  }
+  else
+    writeFile(filename, data.dump());
 }
 
 void CTWWriter::writeFile(const std::filesystem::path& filename, const std::string& text)
+{
+  writeFile(filename, text.data(), text.size());
+}
+
+void CTWWriter::writeFile(const std::filesystem::path& filename, const void* data, size_t size)
 {
   auto* entry = archive_entry_new();
   archive_entry_set_pathname(entry, filename.string().c_str());
-  archive_entry_set_size(entry, text.size());
+  archive_entry_set_size(entry, size);
   archive_entry_set_filetype(entry, AE_IFREG);
   archive_entry_set_perm(entry, 0644);
   if(archive_write_header(m_archive.get(), entry) != ARCHIVE_OK)
     throw LibArchiveError(m_archive.get());
-  archive_write_data(m_archive.get(), text.data(), text.size());
+  archive_write_data(m_archive.get(), data, size);
   archive_entry_free(entry);
 }
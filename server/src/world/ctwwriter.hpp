@@ -37,10 +37,13 @@ class CTWWriter
 
     CTWWriter();
 
+    void writeFile(const std::filesystem::path& filename, const void* data, size_t size);
+
   public:
     CTWWriter(const std::filesystem::path& filename);
     CTWWriter(std::vector<std::byte>& memory);
 
+    //! \brief Write JSON file, CBOR encoded if \a filename has the \ref World::dotCBOR extension
     void writeFile(const std::filesystem::path& filename, const nlohmann::json& data);
     void writeFile(const std::filesystem::path& filename, const std::string& text);
 };
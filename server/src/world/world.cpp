@@ -22,13 +22,17 @@
 
 #include "world.hpp"
 
+#include <chrono>
 #include <boost/algorithm/string.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/string_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 #include "worldsaver.hpp"
+#include "worldjournal.hpp"
+#include "worldstatecheckpoint.hpp"
 
+#include "../core/eventloop.hpp"
 #include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include "../utils/datetimestr.hpp"
@@ -60,6 +64,9 @@
 #include "../board/board.hpp"
 #include "../board/boardlist.hpp"
 #include "../board/list/linkrailtilelist.hpp"
+#include "../board/map/blockpathconflicts.hpp"
+#include "../board/map/blockroutes.hpp"
+#include "../board/map/signalevaluator.hpp"
 #include "../board/nx/nxmanager.hpp"
 #include "../board/tile/rail/nxbuttonrailtile.hpp"
 
@@ -228,55 +235,29 @@ World::World(Private /*unused*/) :
   save{*this, "save", MethodFlags::NoScript,
     [this]()
     {
-      try
-      {
-        // backup world:
-        const std::filesystem::path worldDir = Traintastic::instance->worldDir();
-        const std::filesystem::path worldBackupDir = Traintastic::instance->worldBackupDir();
-
-        if(!std::filesystem::is_directory(worldBackupDir))
-        {
-          std::error_code ec;
-          std::filesystem::create_directories(worldBackupDir, ec);
-          if(ec)
-            Log::log(*this, LogMessage::C1007_CREATING_WORLD_BACKUP_DIRECTORY_FAILED_X, ec);
-        }
-
-        if(std::filesystem::is_directory(worldDir / uuid.value()))
-        {
-          std::error_code ec;
-          std::filesystem::rename(worldDir / uuid.value(), worldBackupDir / uuid.value() += dateTimeStr(), ec);
-          if(ec)
-            Log::log(*this, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
-        }
-
-        if(std::filesystem::is_regular_file(worldDir / uuid.value() += dotCTW))
-        {
-          std::error_code ec;
-          std::filesystem::rename(worldDir / uuid.value() += dotCTW, worldBackupDir / uuid.value() += dateTimeStr() += dotCTW, ec);
-          if(ec)
-            Log::log(*this, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
-        }
+      finishSnapshot(); // a background full save starts a new journal
 
-        // save world:
-        std::filesystem::path savePath = worldDir / uuid.value();
-        if(!Traintastic::instance->settings->saveWorldUncompressed)
-          savePath += dotCTW;
+      const bool formatChanged = Traintastic::instance && m_journal &&
+        ((m_journal->worldPath().extension() == dotCTW) == Traintastic::instance->settings->saveWorldUncompressed ||
+          m_savedBinary != Traintastic::instance->settings->saveWorldBinary);
 
-        WorldSaver saver(*this, savePath);
+      if(m_journal && !formatChanged) // all changes are already in the journal, just make sure they're on disk, no backup is made
+      {
+        const auto start = std::chrono::steady_clock::now();
+        m_journal->flush();
+        m_stateCheckpoint->flush();
+        const auto duration = std::chrono::steady_clock::now() - start;
 
         if(Traintastic::instance)
         {
           Traintastic::instance->settings->lastWorld = uuid.value();
-          Traintastic::instance->worldList->update(*this, savePath);
+          Traintastic::instance->worldList->update(*this, m_journal->worldPath());
         }
 
-        Log::log(*this, LogMessage::N1022_SAVED_WORLD_X, name.value());
-      }
-      catch(const std::exception& e)
-      {
-        Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
+        Log::log(*this, LogMessage::N1022_SAVED_WORLD_X_IN_X_MS, name.value(), std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
       }
+      else
+        saveSnapshot();
     }}
   , getObject_{*this, "get_object", MethodFlags::Internal | MethodFlags::ScriptCallable,
       [this](const std::string& objectId)
@@ -292,6 +273,10 @@ World::World(Private /*unused*/) :
       }}
   , onEvent{*this, "on_event", EventFlags::Scriptable}
 {
+  m_blockPathConflicts = std::make_shared<BlockPathConflicts>();
+  m_blockRoutes = std::make_unique<BlockRoutes>();
+  m_signalEvaluator = std::make_shared<SignalEvaluator>();
+
   Attributes::addDisplayName(uuid, DisplayName::World::uuid);
   m_interfaceItems.add(uuid);
   Attributes::addDisplayName(name, DisplayName::Object::name);
@@ -390,6 +375,10 @@ World::World(Private /*unused*/) :
 
 World::~World()
 {
+  if(m_snapshotThread.joinable()) // in case destroy() isn't called, the journal isn't replaced
+    m_snapshotThread.join();
+  m_stateCheckpoint.reset();
+  m_journal.reset(); // in case destroy() isn't called, deleting objects below must not be journaled
   deleteAll(*interfaces);
   deleteAll(*decoders);
   deleteAll(*inputs);
@@ -463,6 +452,14 @@ ObjectPtr World::getObjectByPath(std::string_view path) const
   return obj;
 }
 
+void World::startJournal(const std::filesystem::path& path, bool truncate)
+{
+  m_stateCheckpoint.reset();
+  m_journal.reset();
+  m_journal = std::make_unique<WorldJournal>(*this, path, truncate);
+  m_stateCheckpoint = std::make_unique<WorldStateCheckpoint>(*this, path);
+}
+
 void World::export_(std::vector<std::byte>& data)
 {
   try
@@ -477,6 +474,18 @@ void World::export_(std::vector<std::byte>& data)
   }
 }
 
+void World::destroying()
+{
+  finishSnapshot();
+  if(m_stateCheckpoint)
+  {
+    m_stateCheckpoint->flush();
+    m_stateCheckpoint.reset();
+  }
+  m_journal.reset(); // writes pending changes
+  Object::destroying();
+}
+
 void World::loaded()
 {
   updateScaleRatio();
@@ -578,6 +587,191 @@ void World::event(const WorldEvent value)
     it.second.lock()->worldEvent(worldState, value);
 }
 
+//! \brief Full save in progress
+//! The world is collected on the event loop (cheap, serialized objects are cached), creating the
+//! backup and encoding and writing the world is done by \ref write, which doesn't access the world.
+struct World::Snapshot
+{
+  std::filesystem::path worldDir;
+  std::filesystem::path worldBackupDir;
+  std::string uuid;
+  std::string backupSuffix;
+  std::filesystem::path path; //!< world directory or CTW file
+  bool binary = false;
+  bool background = false;
+  size_t journalOffset = 0; //!< all journal records up to this offset are part of the snapshot
+  std::unique_ptr<WorldSaver> saver;
+
+  // result:
+  std::chrono::steady_clock::duration duration{};
+  std::vector<std::pair<LogMessage, std::error_code>> backupErrors;
+  std::string error;
+
+  void write()
+  {
+    try
+    {
+      // backup world:
+      if(!std::filesystem::is_directory(worldBackupDir))
+      {
+        std::error_code ec;
+        std::filesystem::create_directories(worldBackupDir, ec);
+        if(ec)
+          backupErrors.emplace_back(LogMessage::C1007_CREATING_WORLD_BACKUP_DIRECTORY_FAILED_X, ec);
+      }
+
+      if(std::filesystem::is_directory(worldDir / uuid))
+      {
+        std::error_code ec;
+        std::filesystem::rename(worldDir / uuid, worldBackupDir / uuid += backupSuffix, ec);
+        if(ec)
+          backupErrors.emplace_back(LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
+
+        // unchanged files are taken from the previous save instead of written again:
+        if(path == worldDir / uuid)
+          saver->setPreviousPath(ec ? path : (worldBackupDir / uuid += backupSuffix));
+      }
+
+      if(std::filesystem::is_regular_file(worldDir / uuid += dotCTW))
+      {
+        std::error_code ec;
+        std::filesystem::rename(worldDir / uuid += dotCTW, worldBackupDir / uuid += backupSuffix += dotCTW, ec);
+        if(ec)
+          backupErrors.emplace_back(LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
+      }
+
+      // save world:
+      const auto start = std::chrono::steady_clock::now();
+      saver->write(path, binary);
+      duration = std::chrono::steady_clock::now() - start;
+
+      // state checkpoint is older than the full save:
+      {
+        std::error_code ec;
+        std::filesystem::remove(WorldStateCheckpoint::filename(path), ec);
+      }
+    }
+    catch(const std::exception& e)
+    {
+      error = e.what();
+    }
+    saver.reset();
+  }
+};
+
+void World::saveSnapshot(bool background)
+{
+  if(m_snapshot)
+  {
+    if(background)
+      return; // already in progress
+    finishSnapshot();
+  }
+
+  try
+  {
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->worldDir = Traintastic::instance->worldDir();
+    snapshot->worldBackupDir = Traintastic::instance->worldBackupDir();
+    snapshot->uuid = uuid.value();
+    snapshot->backupSuffix = dateTimeStr();
+    snapshot->path = snapshot->worldDir / uuid.value();
+    if(!Traintastic::instance->settings->saveWorldUncompressed)
+      snapshot->path += dotCTW;
+    snapshot->binary = Traintastic::instance->settings->saveWorldBinary;
+    snapshot->background = background;
+
+    if(m_journal)
+    {
+      m_journal->flush();
+      snapshot->journalOffset = m_journal->size();
+    }
+    m_stateCheckpoint.reset(); // wait for a checkpoint being written, the full save includes all state
+
+    snapshot->saver.reset(new WorldSaver(*this, snapshot->path.extension() != dotCTW));
+
+    if(background)
+    {
+      m_snapshot = snapshot;
+      m_snapshotThread = std::thread(
+        [world=weak_from_this(), snapshot]()
+        {
+          snapshot->write();
+          EventLoop::call(
+            [world, snapshot]()
+            {
+              if(auto w = std::static_pointer_cast<World>(world.lock()); w && w->m_snapshot == snapshot)
+                w->snapshotSaved(*snapshot);
+            });
+        });
+    }
+    else
+    {
+      snapshot->write();
+      snapshotSaved(*snapshot);
+    }
+  }
+  catch(const std::exception& e)
+  {
+    Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
+    if(m_journal && !m_stateCheckpoint)
+      m_stateCheckpoint = std::make_unique<WorldStateCheckpoint>(*this, m_journal->worldPath());
+  }
+}
+
+void World::snapshotSaved(Snapshot& snapshot)
+{
+  if(m_snapshotThread.joinable())
+    m_snapshotThread.join();
+  m_snapshot.reset();
+
+  for(const auto& [message, ec] : snapshot.backupErrors)
+    Log::log(*this, message, ec);
+
+  try
+  {
+    if(!snapshot.error.empty())
+      throw std::runtime_error(snapshot.error);
+
+    // records journaled while saving in the background aren't part of the snapshot, carry them over:
+    std::string records;
+    if(m_journal)
+    {
+      m_journal->flush();
+      records = m_journal->records(snapshot.journalOffset);
+    }
+    startJournal(snapshot.path, true);
+    m_journal->append(records);
+    m_savedBinary = snapshot.binary;
+
+    if(snapshot.background) // state changed while saving isn't part of the snapshot
+      WorldStateCheckpoint::changed(*this);
+
+    if(Traintastic::instance)
+    {
+      Traintastic::instance->settings->lastWorld = uuid.value();
+      Traintastic::instance->worldList->update(*this, snapshot.path);
+    }
+
+    Log::log(*this, LogMessage::N1022_SAVED_WORLD_X_IN_X_MS, name.value(), std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.duration).count());
+  }
+  catch(const std::exception& e)
+  {
+    Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
+    if(m_journal && !m_stateCheckpoint) // continue the journal, it contains all changes since the last full save
+      m_stateCheckpoint = std::make_unique<WorldStateCheckpoint>(*this, m_journal->worldPath());
+  }
+}
+
+void World::finishSnapshot()
+{
+  if(auto snapshot = m_snapshot)
+  {
+    m_snapshotThread.join();
+    snapshotSaved(*snapshot);
+  }
+}
+
 void World::updateEnabled()
 {
   const bool isOnline = contains(state.value(), WorldState::Online);
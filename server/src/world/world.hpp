@@ -29,14 +29,20 @@
 #include "../core/objectvectorproperty.hpp"
 #include "../core/method.hpp"
 #include "../core/event.hpp"
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include <boost/uuid/uuid.hpp>
+#include <traintastic/utils/stdfilesystem.hpp>
 #include <traintastic/enum/worldevent.hpp>
 #include "../enum/worldscale.hpp"
 #include "../status/status.hpp"
+#include "worldsavecache.hpp"
 #include <traintastic/set/worldstate.hpp>
 
 class WorldLoader;
+class WorldJournal;
+class WorldStateCheckpoint;
 class LNCVProgrammer;
 class DecoderController;
 class InputController;
@@ -51,6 +57,9 @@ class IdentificationList;
 class BoardList;
 class LinkRailTileList;
 class NXManager;
+class BlockPathConflicts;
+class BlockRoutes;
+class SignalEvaluator;
 class Clock;
 class TrainList;
 class RailVehicleList;
@@ -69,18 +78,38 @@ class World : public Object
   friend class Traintastic;
   friend class WorldLoader;
   friend class WorldSaver;
+  friend class WorldJournal;
+  friend class WorldStateCheckpoint;
 
   private:
     struct Private {};
+    struct Snapshot;
 
     void updateEnabled();
     void updateScaleRatio();
 
+    //! \brief Full save, creates a backup and starts a new journal
+    //! \param[in] background Encode and write the world by a background thread, see \ref Snapshot
+    void saveSnapshot(bool background = false);
+    void snapshotSaved(Snapshot& snapshot);
+    //! \brief Wait for a background full save and complete it
+    void finishSnapshot();
+
   protected:
     static void init(World& world);
 
     std::unordered_map<std::string, std::weak_ptr<Object>> m_objects;
-
+    std::unique_ptr<WorldJournal> m_journal;
+    std::unique_ptr<WorldStateCheckpoint> m_stateCheckpoint;
+    mutable WorldSaveCache m_saveCache;
+    std::shared_ptr<Snapshot> m_snapshot; //!< background full save in progress
+    std::thread m_snapshotThread;
+    bool m_savedBinary = false; //!< format of the last full save, see \ref save
+    std::shared_ptr<BlockPathConflicts> m_blockPathConflicts;
+    std::unique_ptr<BlockRoutes> m_blockRoutes;
+    std::shared_ptr<SignalEvaluator> m_signalEvaluator;
+
+    void destroying() final;
     void loaded() final;
     void worldEvent(WorldState worldState, WorldEvent worldEvent) final;
     void event(WorldEvent value);
@@ -92,6 +121,9 @@ class World : public Object
     static constexpr std::string_view dotCTW = ".ctw";
     static constexpr std::string_view filename = "traintastic.json";
     static constexpr std::string_view filenameState = "traintastic.state.json";
+    static constexpr std::string_view dotCBOR = ".cbor";
+    static constexpr std::string_view filenameBinary = "traintastic.cbor"; //!< CBOR encoded \ref filename
+    static constexpr std::string_view filenameStateBinary = "traintastic.state.cbor"; //!< CBOR encoded \ref filenameState
 
     static std::shared_ptr<World> create();
 
@@ -138,6 +170,10 @@ class World : public Object
     Property<bool> noSmoke;
     Property<bool> simulation;
 
+    //! \brief Make sure all changes are on disk
+    //! If the world is journaled only the journal and state checkpoint are flushed, no backup is
+    //! made. A full save, including a backup, is done when the file format settings changed and
+    //! when the journal is compacted, see \ref WorldJournal::compact.
     Method<void()> save;
 
     Method<ObjectPtr(const std::string&)> getObject_;
@@ -157,6 +193,16 @@ class World : public Object
     ObjectPtr getObjectByPath(std::string_view path) const;
 
     void export_(std::vector<std::byte>& data);
+
+    BlockPathConflicts& blockPathConflicts() { return *m_blockPathConflicts; }
+    BlockRoutes& blockRoutes() { return *m_blockRoutes; }
+    SignalEvaluator& signalEvaluator() { return *m_signalEvaluator; }
+
+    //! \brief Journal all changes, they are replayed when the world is loaded from \a path
+    //! State changes are written by a periodic state checkpoint, see \ref WorldStateCheckpoint.
+    //! \param[in] path World directory or CTW file
+    //! \param[in] truncate Discard the existing journal, \a path contains all changes
+    void startJournal(const std::filesystem::path& path, bool truncate);
 };
 
 #endif
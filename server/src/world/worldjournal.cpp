@@ -0,0 +1,548 @@
+/**
+ * server/src/world/worldjournal.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "worldjournal.hpp"
+#include <fstream>
+#include <map>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#ifdef WIN32
+  #include <io.h>
+#else
+  #include <unistd.h>
+#endif
+#include "world.hpp"
+#include "worldsaver.hpp"
+#include "../core/eventloop.hpp"
+#include "../core/abstractproperty.hpp"
+#include "../core/abstractvectorproperty.hpp"
+#include "../core/idobject.hpp"
+#include "../core/stateobject.hpp"
+#include "../log/log.hpp"
+
+using nlohmann::json;
+
+static void eraseStates(json& states, const std::string& id)
+{
+  // states of the object itself and all its sub objects:
+  for(auto it = states.begin(); it != states.end();)
+  {
+    const std::string& key = it.key();
+    if(key.compare(0, id.size(), id) == 0 && (key.size() == id.size() || key[id.size()] == '.'))
+      it = states.erase(it);
+    else
+      ++it;
+  }
+}
+
+static void renameStates(json& states, const std::string& oldId, const std::string& newId)
+{
+  // states of the object itself and all its sub objects:
+  json renamed = json::object();
+  for(auto it = states.begin(); it != states.end();)
+  {
+    const std::string& key = it.key();
+    if(key.compare(0, oldId.size(), oldId) == 0 && (key.size() == oldId.size() || key[oldId.size()] == '.'))
+    {
+      renamed[newId + key.substr(oldId.size())] = std::move(it.value());
+      it = states.erase(it);
+    }
+    else
+      ++it;
+  }
+  for(auto& [key, value] : renamed.items())
+    states[key] = std::move(value);
+}
+
+static bool isPartOf(const Object& object, const Object& top)
+{
+  const Object* p = &object;
+  while(const Object* parent = p->parentObject())
+    p = parent;
+  return p == &top;
+}
+
+//! \brief Check if an object or one of its sub objects stores a reference to (a sub object of) target
+static bool refersTo(const Object& object, const Object& target)
+{
+  for(const auto& item : object.interfaceItems())
+  {
+    const auto* baseProperty = dynamic_cast<const BaseProperty*>(&item.second);
+    if(!baseProperty || baseProperty->type() != ValueType::Object || (!baseProperty->isStoreable() && !baseProperty->isStateStoreable()))
+      continue;
+
+    const bool isSubObject = contains(baseProperty->flags(), PropertyFlags::SubObject);
+
+    if(const auto* property = dynamic_cast<const AbstractProperty*>(baseProperty))
+    {
+      if(ObjectPtr value = property->toObject())
+        if(isSubObject ? refersTo(*value, target) : isPartOf(*value, target))
+          return true;
+    }
+    else if(const auto* vectorProperty = dynamic_cast<const AbstractVectorProperty*>(baseProperty))
+    {
+      const size_t size = vectorProperty->size();
+      for(size_t i = 0; i < size; i++)
+        if(ObjectPtr value = vectorProperty->getObject(i))
+          if(isSubObject ? refersTo(*value, target) : isPartOf(*value, target))
+            return true;
+    }
+  }
+  return false;
+}
+
+std::filesystem::path WorldJournal::filename(const std::filesystem::path& path)
+{
+  return std::filesystem::path(path).replace_extension(dotJournal);
+}
+
+size_t WorldJournal::replay(const std::filesystem::path& filename, json& data, json& state, Files& files)
+{
+  std::ifstream file(filename);
+  if(!file.is_open())
+    return 0;
+
+  std::string line;
+  if(!std::getline(file, line))
+    return 0;
+
+  size_t position = line.size() + 1;
+
+  // journal must belong to this world:
+  json header = json::parse(line, nullptr, false);
+  if(header.is_discarded() || !header.is_object() || header.value("uuid", "") != data.value("uuid", ""))
+    return 0;
+
+  // state is a checkpoint of this journal, it contains the states of all records before the checkpoint:
+  size_t checkpointPosition = 0;
+  if(state.is_object() && state["uuid"] == data["uuid"])
+  {
+    if(auto checkpoint = state.find("journal"); checkpoint != state.end() && checkpoint->is_object() &&
+        checkpoint->value("id", "") == header.value("id", "?"))
+    {
+      checkpointPosition = checkpoint->value<size_t>("offset", 0);
+    }
+  }
+
+  if(!state.is_object() || state["uuid"] != data["uuid"])
+  {
+    state = json::object();
+    state["uuid"] = data["uuid"];
+  }
+  json& states = state["states"];
+  if(!states.is_object())
+    states = json::object();
+
+  std::map<std::string, json> objects;
+  for(json& object : data.value("objects", json::array()))
+    objects.emplace(object["id"].get<std::string>(), std::move(object));
+
+  std::map<std::string, json> stateObjects;
+  for(json& object : state.value("objects", json::array()))
+    stateObjects.emplace(object["id"].get<std::string>(), std::move(object));
+
+  size_t count = 0;
+  while(std::getline(file, line))
+  {
+    const bool checkpointed = position < checkpointPosition;
+    position += line.size() + 1;
+
+    json record = json::parse(line, nullptr, false);
+    if(record.is_discarded() || !record.is_object())
+      continue; // incomplete write, server wasn't shut down properly
+
+    if(auto it = record.find("delete"); it != record.end())
+    {
+      const auto id = it->get<std::string>();
+      objects.erase(id);
+      if(!checkpointed)
+      {
+        stateObjects.erase(id);
+        eraseStates(states, id);
+      }
+    }
+    else if(auto rename = record.find("rename"); rename != record.end())
+    {
+      const auto from = (*rename)["from"].get<std::string>();
+      const auto to = (*rename)["to"].get<std::string>();
+      if(auto n = objects.extract(from))
+      {
+        n.mapped()["id"] = to;
+        n.key() = to;
+        objects.insert(std::move(n));
+      }
+      if(!checkpointed)
+        renameStates(states, from, to);
+    }
+    else if(auto put = record.find("put"); put != record.end())
+    {
+      auto id = (*put)["id"].get<std::string>();
+      if(!checkpointed)
+        eraseStates(states, id);
+      objects[std::move(id)] = std::move(*put);
+    }
+    else if(auto putState = record.find("put_state"); putState != record.end())
+    {
+      if(!checkpointed)
+      {
+        auto id = (*putState)["id"].get<std::string>();
+        stateObjects[std::move(id)] = std::move(*putState);
+      }
+    }
+    else if(auto world = record.find("world"); world != record.end())
+    {
+      if(!checkpointed)
+        eraseStates(states, std::string{World::id});
+      for(auto& [key, value] : world->items())
+        data[key] = value;
+    }
+    else
+      continue;
+
+    if(auto it = record.find("states"); it != record.end() && !checkpointed)
+      for(auto& [id, value] : it->items())
+        states[id] = value;
+
+    if(auto it = record.find("files"); it != record.end())
+      for(auto& [name, value] : it->items())
+      {
+        if(value.is_string())
+          files[name] = value.get<std::string>();
+        else
+          files[name] = std::nullopt;
+      }
+
+    count++;
+  }
+
+  json& dataObjects = data["objects"] = json::array();
+  for(auto& it : objects) // std::map, sorted by id just like WorldSaver does
+    dataObjects.push_back(std::move(it.second));
+
+  json& stateObjectsArray = state["objects"] = json::array();
+  for(auto& it : stateObjects)
+    stateObjectsArray.push_back(std::move(it.second));
+
+  return count;
+}
+
+Object* WorldJournal::topLevelObject(Object& object, World*& world)
+{
+  Object* top = &object;
+  while(Object* parent = top->parentObject())
+    top = parent;
+
+  if(auto* idObject = dynamic_cast<IdObject*>(top))
+    world = &idObject->world();
+  else if(auto* stateObject = dynamic_cast<StateObject*>(top))
+    world = stateObject->world();
+  else
+    world = dynamic_cast<World*>(top);
+
+  return world ? top : nullptr;
+}
+
+void WorldJournal::changed(Object& object)
+{
+  World* world = nullptr;
+  if(Object* top = topLevelObject(object, world))
+  {
+    world->m_saveCache.invalidate(*top);
+    if(world->m_journal)
+      world->m_journal->objectChanged(*top);
+  }
+}
+
+void WorldJournal::renamed(World& world, Object& object, const std::string& oldId, const std::string& newId)
+{
+  if(world.m_journal)
+    world.m_journal->objectRenamed(oldId, newId);
+
+  // objects referring to the renamed object store its id, they must be saved again:
+  if(refersTo(world, object))
+    changed(world);
+  for(const auto& it : world.m_objects)
+    if(ObjectPtr referrer = it.second.lock(); referrer && referrer.get() != &object && refersTo(*referrer, object))
+      changed(*referrer);
+}
+
+WorldJournal::WorldJournal(World& world, std::filesystem::path worldPath, bool truncate)
+  : m_world{world}
+  , m_worldPath{std::move(worldPath)}
+  , m_filename{filename(m_worldPath)}
+  , m_flushTimer{EventLoop::ioContext}
+{
+  std::error_code ec;
+  if(!truncate && std::filesystem::file_size(m_filename, ec) == 0)
+    truncate = true;
+
+  m_file = std::fopen(m_filename.string().c_str(), truncate ? "wb" : "ab");
+  if(!m_file)
+  {
+    Log::log(m_world, LogMessage::E1009_WRITING_WORLD_JOURNAL_FAILED_X, m_filename.string());
+    return;
+  }
+
+  if(truncate)
+  {
+    m_id = to_string(boost::uuids::random_generator()());
+
+    json header = json::object();
+    header["uuid"] = m_world.uuid.value();
+    header["id"] = m_id;
+    write(header);
+  }
+  else
+  {
+    if(std::ifstream file(m_filename); file.is_open())
+    {
+      std::string line;
+      std::getline(file, line);
+      json header = json::parse(line, nullptr, false);
+      if(header.is_object())
+        m_id = header.value("id", "");
+    }
+
+    m_size = std::filesystem::file_size(m_filename, ec);
+    if(std::fputc('\n', m_file) != EOF) // terminate a possibly incomplete last record
+      m_size++;
+  }
+  std::fflush(m_file);
+}
+
+WorldJournal::~WorldJournal()
+{
+  flush();
+  if(m_file)
+    std::fclose(m_file);
+}
+
+std::string WorldJournal::records(size_t offset) const
+{
+  std::string records;
+  if(offset >= m_size)
+    return records;
+
+  std::ifstream file(m_filename, std::ios::in | std::ios::binary);
+  if(!file.is_open() || !file.seekg(static_cast<std::streamoff>(offset)))
+    throw std::runtime_error("can't read " + m_filename.string());
+  records.resize(m_size - offset);
+  file.read(records.data(), static_cast<std::streamsize>(records.size()));
+  records.resize(static_cast<size_t>(file.gcount()));
+  return records;
+}
+
+void WorldJournal::append(const std::string& records)
+{
+  if(!m_file || records.empty())
+    return;
+
+  if(std::fwrite(records.data(), 1, records.size(), m_file) != records.size() || std::fflush(m_file) != 0)
+  {
+    Log::log(m_world, LogMessage::E1009_WRITING_WORLD_JOURNAL_FAILED_X, m_filename.string());
+    return;
+  }
+  m_size += records.size();
+#ifdef WIN32
+  _commit(_fileno(m_file));
+#else
+  fsync(fileno(m_file));
+#endif
+}
+
+void WorldJournal::objectChanged(Object& object)
+{
+  if(!m_file)
+    return;
+
+  // an object may be allocated at the address of a destroyed object:
+  auto [it, inserted] = m_changed.try_emplace(&object, object.weak_from_this());
+  if(!inserted && it->second.expired())
+    it->second = object.weak_from_this();
+
+  scheduleFlush();
+}
+
+void WorldJournal::objectDeleted(const std::string& id)
+{
+  if(!m_file)
+    return;
+
+  m_removed.emplace_back(id, std::string());
+  scheduleFlush();
+}
+
+void WorldJournal::objectRenamed(const std::string& oldId, const std::string& newId)
+{
+  if(!m_file)
+    return;
+
+  m_removed.emplace_back(oldId, newId);
+  scheduleFlush();
+}
+
+void WorldJournal::compact()
+{
+  if(m_compactScheduled || m_world.m_snapshot)
+    return;
+
+  m_compactScheduled = true;
+  EventLoop::call(
+    [world=std::weak_ptr<Object>(m_world.weak_from_this()), journal=this]()
+    {
+      auto w = std::static_pointer_cast<World>(world.lock());
+      if(!w)
+        return;
+
+      // a successful save replaces the journal, if it is still in use allow a new attempt:
+      struct ResetScheduled
+      {
+        World& world;
+        WorldJournal* journal;
+
+        ~ResetScheduled()
+        {
+          if(world.m_journal.get() == journal)
+            journal->m_compactScheduled = false;
+        }
+      } resetScheduled{*w, journal};
+
+      w->saveSnapshot(true);
+    });
+}
+
+void WorldJournal::flush()
+{
+  if(m_flushScheduled)
+  {
+    m_flushTimer.cancel();
+    m_flushScheduled = false;
+  }
+
+  if(!m_file || (m_changed.empty() && m_removed.empty()))
+    return;
+
+  try
+  {
+    // deletes and renames first, in order, an id can be reused by a new object:
+    for(const auto& [id, newId] : m_removed)
+    {
+      json record = json::object();
+      if(newId.empty())
+        record["delete"] = id;
+      else
+        record["rename"] = {{"from", id}, {"to", newId}};
+      write(record);
+    }
+    m_removed.clear();
+
+    auto changed = std::move(m_changed);
+    m_changed.clear();
+
+    for(const auto& it : changed)
+    {
+      ObjectPtr object = it.second.lock();
+      if(!object || object->dying())
+        continue;
+
+      json record = json::object();
+
+      if(object.get() == &m_world)
+      {
+        WorldSaver saver;
+        json data = json::object();
+        json state = json::object();
+        m_world.Object::save(saver, data, state);
+        data.erase("class_id");
+        if(!state.empty())
+          saver.m_states[m_world.getObjectId()] = state;
+        record["world"] = std::move(data);
+        if(!saver.m_states.empty())
+          record["states"] = std::move(saver.m_states);
+      }
+      else
+      {
+        // the serialized object is cached, a following save doesn't have to serialize it again:
+        const auto& fragment = WorldSaver::fragment(m_world, object);
+
+        record[std::dynamic_pointer_cast<StateObject>(object) ? "put_state" : "put"] = fragment.data;
+
+        if(!fragment.states.empty())
+          record["states"] = fragment.states;
+
+        if(!fragment.writeFiles.empty() || !fragment.deleteFiles.empty())
+        {
+          json files = json::object();
+          for(const auto& filename : fragment.deleteFiles)
+            files[filename.generic_string()] = nullptr;
+          for(const auto& file : fragment.writeFiles)
+            files[file.first.generic_string()] = file.second;
+          record["files"] = std::move(files);
+        }
+      }
+
+      write(record);
+    }
+
+    if(std::fflush(m_file) != 0)
+      throw std::runtime_error("flush failed");
+#ifdef WIN32
+    _commit(_fileno(m_file));
+#else
+    fsync(fileno(m_file));
+#endif
+  }
+  catch(const std::exception& e)
+  {
+    Log::log(m_world, LogMessage::E1009_WRITING_WORLD_JOURNAL_FAILED_X, e.what());
+  }
+
+  if(m_size >= compactSize)
+    compact();
+}
+
+void WorldJournal::scheduleFlush()
+{
+  if(m_flushScheduled)
+    return;
+
+  m_flushScheduled = true;
+  m_flushTimer.expires_after(flushDelay);
+  m_flushTimer.async_wait(
+    [this](const boost::system::error_code& ec)
+    {
+      if(!ec)
+      {
+        m_flushScheduled = false;
+        flush();
+      }
+    });
+}
+
+void WorldJournal::write(const json& record)
+{
+  std::string line = record.dump();
+  line.push_back('\n');
+  if(std::fwrite(line.data(), 1, line.size(), m_file) != line.size())
+    throw std::runtime_error("write failed");
+  m_size += line.size();
+}
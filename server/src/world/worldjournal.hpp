@@ -0,0 +1,138 @@
+/**
+ * server/src/world/worldjournal.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_WORLDJOURNAL_HPP
+#define TRAINTASTIC_SERVER_WORLD_WORLDJOURNAL_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio/steady_timer.hpp>
+#include <traintastic/utils/stdfilesystem.hpp>
+#include "../utils/json.hpp"
+
+class Object;
+class World;
+
+//! \brief Append-only journal of world changes since the last full save
+//!
+//! Changed objects are collected and written as one JSON record per line after a short delay,
+//! each record contains the complete data and state of a top level object (the world, an
+//! \ref IdObject or a \ref StateObject) including its sub objects. When the world is loaded
+//! the journal is replayed on top of the last full save, so no changes are lost when the
+//! server isn't shut down properly. A full save starts a new journal.
+class WorldJournal
+{
+  public:
+    using Files = std::unordered_map<std::string, std::optional<std::string>>;
+
+    static constexpr std::string_view dotJournal = ".journal";
+
+    //! Delay between a change and writing it to the journal.
+    static constexpr auto flushDelay = std::chrono::milliseconds(500);
+
+    //! Journal size that triggers a full save.
+    static constexpr size_t compactSize = 16 * 1024 * 1024;
+
+  private:
+    World& m_world;
+    const std::filesystem::path m_worldPath;
+    const std::filesystem::path m_filename;
+    std::FILE* m_file = nullptr;
+    std::string m_id;
+    size_t m_size = 0;
+    std::unordered_map<const Object*, std::weak_ptr<Object>> m_changed;
+    std::vector<std::pair<std::string, std::string>> m_removed; //!< deleted (empty second) or renamed ids, in order
+    boost::asio::steady_timer m_flushTimer;
+    bool m_flushScheduled = false;
+    bool m_compactScheduled = false;
+
+    void scheduleFlush();
+    void write(const nlohmann::json& record);
+
+  public:
+    //! \brief Get journal filename for a world
+    //! \param[in] path World directory or CTW file
+    static std::filesystem::path filename(const std::filesystem::path& path);
+
+    //! \brief Get top level object and world of an object
+    //! \return Top level object or \c nullptr if the object isn't part of a world
+    static Object* topLevelObject(Object& object, World*& world);
+
+    //! \brief Replay journal on top of world data and state
+    //! States of records written before a state checkpoint are skipped, see \ref WorldStateCheckpoint.
+    //! \param[in] filename Journal filename
+    //! \param[in,out] data World data (traintastic.json)
+    //! \param[in,out] state World state (traintastic.state.json), can be a state checkpoint
+    //! \param[out] files Files written (or deleted if empty) by objects
+    //! \return Number of records applied
+    static size_t replay(const std::filesystem::path& filename, nlohmann::json& data, nlohmann::json& state, Files& files);
+
+    //! \brief Mark object as changed
+    //! Looks up the world the object belongs to, does nothing if it isn't journaled.
+    static void changed(Object& object);
+
+    //! \brief Object id changed
+    //! Marks all objects referring to the object as changed, so they are journaled and saved with the new id.
+    //! \param[in] object The renamed object, already registered with its new id
+    static void renamed(World& world, Object& object, const std::string& oldId, const std::string& newId);
+
+    //! \param[in] world World to journal
+    //! \param[in] worldPath World directory or CTW file the journal belongs to
+    //! \param[in] truncate Start a new journal, else append to the existing one
+    WorldJournal(World& world, std::filesystem::path worldPath, bool truncate);
+    ~WorldJournal();
+
+    WorldJournal(const WorldJournal&) = delete;
+    WorldJournal& operator =(const WorldJournal&) = delete;
+
+    const std::filesystem::path& worldPath() const { return m_worldPath; }
+
+    //! \brief Unique id of the journal, a full save starts a new journal
+    const std::string& id() const { return m_id; }
+
+    //! \brief Journal size in bytes, position of the next record
+    size_t size() const { return m_size; }
+
+    //! \brief Read the records written since \a offset
+    //! Used to carry records written during a background full save over to the new journal.
+    std::string records(size_t offset) const;
+
+    //! \brief Append records, see \ref records
+    void append(const std::string& records);
+
+    void objectChanged(Object& object);
+    void objectDeleted(const std::string& id);
+    void objectRenamed(const std::string& oldId, const std::string& newId);
+
+    //! \brief Request a full save, e.g. when the journal grows too large
+    void compact();
+
+    //! \brief Write all pending changes to disk
+    void flush();
+};
+
+#endif
@@ -23,10 +23,12 @@
 #include "worldlist.hpp"
 #include <fstream>
 #include <boost/uuid/string_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
 #include "../traintastic/traintastic.hpp"
 #include "../log/log.hpp"
 #include "worldlisttablemodel.hpp"
 #include "ctwreader.hpp"
+#include "worldloader.hpp"
 #include "libarchiveerror.hpp"
 
 using nlohmann::json;
@@ -55,49 +57,50 @@ void WorldList::buildIndex()
 
   m_items.clear();
 
+  json index;
+  if(std::ifstream file(m_path / indexFilename); file.is_open())
+    index = json::parse(file, nullptr, false);
+  if(!index.is_object())
+    index = json::object();
+
+  m_index = json::object();
+
   WorldInfo info;
   for(const auto& it : std::filesystem::directory_iterator(m_path))
   {
     info.path = it.path();
 
-    if(info.path.extension() == World::dotCTW)
+    json entry = indexEntry(info.path);
+    if(entry.is_null())
+      continue; // not a world
+
+    const std::string key = info.path.filename().string();
+    if(auto cached = index.find(key); cached != index.end() && cached->is_object() &&
+        cached->value("mtime", json()) == entry["mtime"] && cached->value("size", json()) == entry["size"])
+    {
+      entry = *cached;
+    }
+    else if(readInfo(info.path, info))
     {
-      try
-      {
-        CTWReader ctw(info.path);
-
-        json world;
-        if(ctw.readFile(World::filename, world) && readInfo(world, info))
-          m_items.push_back(info);
-      }
-      catch(const LibArchiveError& e)
-      {
-        Log::log(Traintastic::classId, LogMessage::W1003_READING_WORLD_X_FAILED_LIBARCHIVE_ERROR_X_X, info.path.filename(), e.errorCode, e.what());
-      }
-      continue;
+      entry["uuid"] = to_string(info.uuid);
+      entry["name"] = info.name;
     }
+    else
+      entry["uuid"] = ""; // invalid, don't read again until it is changed
 
-    const auto worldFile = info.path / World::filename;
-    if(std::filesystem::is_directory(info.path) && std::filesystem::is_regular_file(worldFile))
+    const std::string uuid = entry.value("uuid", "");
+    if(!uuid.empty())
     {
-      std::ifstream file(worldFile);
-      if(file.is_open())
-      {
-        try
-        {
-          json world = json::parse(file);
-
-          if(readInfo(world, info))
-            m_items.push_back(info);
-        }
-        catch(const std::exception& e)
-        {
-          Log::log(Traintastic::classId, LogMessage::C1004_READING_WORLD_FAILED_X_X, e, worldFile);
-        }
-      }
+      info.uuid = boost::uuids::string_generator()(uuid);
+      info.name = entry.value("name", "");
+      m_items.push_back(info);
     }
+    m_index[key] = std::move(entry);
   }
 
+  if(m_index != index)
+    saveIndex();
+
   std::sort(m_items.begin(), m_items.end(), [](const WorldInfo& a, const WorldInfo& b) -> bool { return a > b; });
 
   //for(auto& model : m_models)
@@ -117,6 +120,15 @@ void WorldList::update(World& world, const std::filesystem::path& path)
   {
     m_items.emplace_back(WorldInfo{uuid, world.name.value(), path});
   }
+
+  // the name can change without writing the world file (see WorldJournal), so always update the index:
+  if(json entry = indexEntry(path); !entry.is_null())
+  {
+    entry["uuid"] = world.uuid.value();
+    entry["name"] = world.name.value();
+    m_index[path.filename().string()] = std::move(entry);
+    saveIndex();
+  }
 }
 
 TableModelPtr WorldList::getModel()
@@ -124,6 +136,89 @@ TableModelPtr WorldList::getModel()
   return std::make_shared<WorldListTableModel>(*this);
 }
 
+std::filesystem::path WorldList::worldFile(const std::filesystem::path& path)
+{
+  if(path.extension() == World::dotCTW)
+    return std::filesystem::is_regular_file(path) ? path : std::filesystem::path();
+
+  if(std::filesystem::is_directory(path))
+    for(auto filename : {World::filenameBinary, World::filename})
+      if(std::filesystem::is_regular_file(path / filename))
+        return path / filename;
+
+  return {};
+}
+
+json WorldList::indexEntry(const std::filesystem::path& path)
+{
+  const auto file = worldFile(path);
+  if(file.empty())
+    return {};
+
+  std::error_code ec;
+  const auto mtime = std::filesystem::last_write_time(file, ec);
+  if(ec)
+    return {};
+  const auto size = std::filesystem::file_size(file, ec);
+  if(ec)
+    return {};
+
+  json entry = json::object();
+  entry["mtime"] = static_cast<int64_t>(mtime.time_since_epoch().count());
+  entry["size"] = static_cast<uint64_t>(size);
+  return entry;
+}
+
+bool WorldList::readInfo(const std::filesystem::path& path, WorldInfo& info)
+{
+  if(path.extension() == World::dotCTW)
+  {
+    try
+    {
+      CTWReader ctw(path);
+
+      json world;
+      return ctw.readFile(World::filenameBinary, World::filename, world) && readInfo(world, info);
+    }
+    catch(const LibArchiveError& e)
+    {
+      Log::log(Traintastic::classId, LogMessage::W1003_READING_WORLD_X_FAILED_LIBARCHIVE_ERROR_X_X, path.filename(), e.errorCode, e.what());
+    }
+    catch(const std::exception& e)
+    {
+      Log::log(Traintastic::classId, LogMessage::C1004_READING_WORLD_FAILED_X_X, e, path);
+    }
+  }
+  else
+  {
+    try
+    {
+      return readInfo(WorldLoader::readWorldFile(path, World::filenameBinary, World::filename), info);
+    }
+    catch(const std::exception& e)
+    {
+      Log::log(Traintastic::classId, LogMessage::C1004_READING_WORLD_FAILED_X_X, e, path);
+    }
+  }
+  return false;
+}
+
+void WorldList::saveIndex()
+{
+  // write to a temporary file first, so a crash can't leave a corrupt index:
+  const auto filename = m_path / indexFilename;
+  auto tmpFilename = filename;
+  tmpFilename += ".tmp";
+  {
+    std::ofstream file(tmpFilename);
+    if(!file.is_open())
+      return;
+    file << m_index.dump(2);
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmpFilename, filename, ec);
+}
+
 bool WorldList::readInfo(const json& world, WorldInfo& info)
 {
   auto it = world.find("uuid");
@@ -50,10 +50,19 @@ class WorldList : public Object, public Table
     };
 
   protected:
+    //! Cached world info, keyed by world filename, so worlds don't have to be opened at startup.
+    static constexpr std::string_view indexFilename = "index.json";
+
     static bool readInfo(const nlohmann::json& world, WorldInfo& info);
+    static std::filesystem::path worldFile(const std::filesystem::path& path);
+    static nlohmann::json indexEntry(const std::filesystem::path& path);
+    static bool readInfo(const std::filesystem::path& path, WorldInfo& info);
 
     const std::filesystem::path m_path;
     std::vector<WorldInfo> m_items;
+    nlohmann::json m_index;
+
+    void saveIndex();
     std::vector<WorldListTableModel*> m_models;
 
   public:
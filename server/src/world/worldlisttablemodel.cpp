@@ -70,3 +70,10 @@ std::string WorldListTableModel::getText(uint32_t column, uint32_t row) const
   return "";
 }
 
+std::string WorldListTableModel::getRowId(uint32_t row) const
+{
+  if(row < rowCount())
+    return to_string(m_worldList->m_items[row].uuid);
+  return {};
+}
+
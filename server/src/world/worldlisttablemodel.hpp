@@ -40,6 +40,7 @@ class WorldListTableModel final : public TableModel
     ~WorldListTableModel() final;
 
     std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getRowId(uint32_t row) const final;
 };
 
 #endif
@@ -22,6 +22,7 @@
 
 #include "worldloader.hpp"
 #include <fstream>
+#include <thread>
 #include <boost/algorithm/string.hpp>
 #include <boost/uuid/string_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -30,6 +31,8 @@
 #include "../utils/startswith.hpp"
 #include "../utils/stripsuffix.hpp"
 #include "ctwreader.hpp"
+#include "worldstatecheckpoint.hpp"
+#include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include <version.hpp>
 
@@ -46,6 +49,22 @@
 
 using nlohmann::json;
 
+json WorldLoader::readWorldFile(const std::filesystem::path& path, std::string_view filenameBinary, std::string_view filename)
+{
+  if(std::ifstream file(path / filenameBinary, std::ios::in | std::ios::binary | std::ios::ate); file.is_open())
+  {
+    std::vector<uint8_t> cbor(static_cast<size_t>(file.tellg()));
+    file.seekg(std::ios::beg);
+    file.read(reinterpret_cast<char*>(cbor.data()), cbor.size());
+    return json::from_cbor(cbor);
+  }
+
+  std::ifstream file(path / filename);
+  if(!file.is_open())
+    throw std::runtime_error("can't open " + (path / filename).string());
+  return json::parse(file);
+}
+
 WorldLoader::WorldLoader()
   : m_world{World::create()}
 {
@@ -54,17 +73,25 @@ WorldLoader::WorldLoader()
 WorldLoader::WorldLoader(std::filesystem::path path)
   : WorldLoader()
 {
-  if(path.extension() == World::dotCTW)
-    m_ctw = std::make_unique<CTWReader>(path);
+  m_worldPath = std::move(path);
+  if(m_worldPath.extension() == World::dotCTW)
+    m_ctw = std::make_unique<CTWReader>(m_worldPath);
   else
-    m_path = std::move(path);
+    m_path = m_worldPath;
 
   load();
+
+  if(m_journalRecords != 0)
+    Log::log(*m_world, LogMessage::N1029_APPLIED_X_JOURNALED_WORLD_CHANGES, m_journalRecords);
+
+  // continue the journal, start a new one if no changes were applied:
+  m_world->startJournal(m_worldPath, m_journalRecords == 0);
 }
 
 WorldLoader::WorldLoader(const std::vector<std::byte>& memory)
   : WorldLoader()
 {
+  m_memory = &memory;
   m_ctw = std::make_unique<CTWReader>(memory);
 
   load();
@@ -103,33 +130,35 @@ json WorldLoader::getState(const std::string& id) const
   return m_states.value(id, json::object());
 }
 
+std::launch WorldLoader::launchPolicy()
+{
+#ifdef TRAINTASTIC_TEST
+  if(!parallel)
+    return std::launch::deferred;
+#endif
+  return std::launch::async;
+}
+
 void WorldLoader::load()
 {
   m_states = json::object();
 
-  json data;
-  json state;
+  // state and scripts are read (and compiled) by a worker while the world data is read and parsed:
+  auto prefetched = std::async(launchPolicy(), &WorldLoader::prefetch, this);
 
-  // load file(s):
+  // load file, binary (CBOR) if available else JSON:
+  json data;
   if(m_ctw)
   {
-    if(!m_ctw->readFile(World::filename, data))
+    bool text = false;
+    if(!m_ctw->readFile(World::filenameBinary, World::filename, data, &text))
       throw std::runtime_error(std::string("can't read ").append(World::filename));
-
-    if(!m_ctw->readFile(World::filenameState, state))
-      throw std::runtime_error(std::string("can't read ").append(World::filenameState));
+    m_world->m_savedBinary = !text;
   }
   else
   {
-    std::ifstream file(m_path / World::filename);
-    if(!file.is_open())
-      throw std::runtime_error("can't open " + (m_path / World::filename).string());
-    data = json::parse(file);
-
-    std::ifstream stateFile(m_path / World::filenameState);
-    if(!stateFile.is_open())
-      throw std::runtime_error("can't open " + (m_path / World::filenameState).string());
-    state = json::parse(stateFile);
+    data = readWorldFile(m_path, World::filenameBinary, World::filename);
+    m_world->m_savedBinary = std::filesystem::is_regular_file(m_path / World::filenameBinary);
   }
 
   // check if UUID is valid:
@@ -159,28 +188,32 @@ void WorldLoader::load()
     }
   }
 
+  json state;
+  {
+    Prefetched result = prefetched.get();
+    state = std::move(result.state);
+    m_files = std::move(result.files);
+    m_luaChunks = std::move(result.luaChunks);
+  }
+
+  // changes since last save:
+  if(!m_worldPath.empty())
+    m_journalRecords = WorldJournal::replay(WorldJournal::filename(m_worldPath), data, state, m_journalFiles);
+
   // state data
   if(state.is_object() && state["uuid"] == data["uuid"])
   {
-    m_states = state["states"];
-    auto stateObjects = state.value("objects", json::array());
-    data["objects"].insert(data["objects"].end(), stateObjects.begin(), stateObjects.end());
+    m_states = std::move(state["states"]);
+    if(auto stateObjects = state.find("objects"); stateObjects != state.end() && stateObjects->is_array())
+      for(json& object : *stateObjects)
+        data["objects"].push_back(std::move(object));
   }
 
   // create a list of all objects
-  m_objects.insert({m_world->getObjectId(), {data, m_world, false}});
-  for(json object : data["objects"])
-  {
-    if(auto it = object.find("id"); it != object.end())
-    {
-      auto id = it.value().get<std::string>();
-      if(!isValidObjectId(id))
-        throw std::runtime_error("invalid object id value");
-      m_objects.insert({std::move(id), {object, nullptr, false}});
-    }
-    else
-      throw std::runtime_error("id missing");
-  }
+  json objects = std::move(data["objects"]);
+  data.erase("objects");
+  m_objects.insert({m_world->getObjectId(), {std::move(data), m_world, false}});
+  buildIndex(objects);
 
   // then create all objects
   for(auto& it : m_objects)
@@ -197,6 +230,100 @@ void WorldLoader::load()
     it.second.object->loaded();
 }
 
+WorldLoader::Prefetched WorldLoader::prefetch() const
+{
+  Prefetched prefetched;
+
+  if(m_ctw)
+  {
+    // use a reader of its own, the archive is read by the loader at the same time:
+    auto ctw = m_memory ? std::make_unique<CTWReader>(*m_memory) : std::make_unique<CTWReader>(m_worldPath);
+
+    if(!ctw->readFile(World::filenameStateBinary, World::filenameState, prefetched.state))
+      throw std::runtime_error(std::string("can't read ").append(World::filenameState));
+
+    ctw->readFiles(Lua::Script::scripts, prefetched.files);
+  }
+  else
+  {
+    prefetched.state = readWorldFile(m_path, World::filenameStateBinary, World::filenameState);
+
+    std::error_code ec;
+    for(const auto& entry : std::filesystem::directory_iterator(m_path / Lua::Script::scripts, ec))
+    {
+      if(entry.path().extension() != Lua::Script::dotLua)
+        continue;
+
+      std::ifstream file(entry.path(), std::ios::in | std::ios::binary);
+      if(file.is_open())
+      {
+        std::string& code = prefetched.files[(std::filesystem::path(Lua::Script::scripts) / entry.path().filename()).generic_string()];
+        code.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+      }
+    }
+  }
+
+  // state checkpoint written after the last full save, newer than the saved state:
+  if(!m_worldPath.empty())
+  {
+    if(std::ifstream file(WorldStateCheckpoint::filename(m_worldPath), std::ios::in | std::ios::binary); file.is_open())
+    {
+      json checkpoint = json::from_cbor(file, true, false);
+      if(checkpoint.is_object() && checkpoint.value("uuid", "") == prefetched.state.value("uuid", ""))
+        prefetched.state = std::move(checkpoint);
+    }
+  }
+
+  for(const auto& [filename, code] : prefetched.files)
+  {
+    if(auto chunk = Lua::Script::compile(code); !chunk.empty())
+      prefetched.luaChunks.emplace(filename, std::move(chunk));
+  }
+
+  return prefetched;
+}
+
+void WorldLoader::buildIndex(json& objects)
+{
+  using Index = std::vector<std::pair<std::string, json>>;
+
+  if(!objects.is_array())
+    return;
+
+  auto& array = objects.get_ref<json::array_t&>();
+  const size_t count = array.size();
+  const size_t chunkSize = std::max<size_t>(indexChunkSizeMin, count / std::max(1U, std::thread::hardware_concurrency()) + 1);
+
+  // validate ids in parallel, object data is moved, not copied:
+  std::vector<std::future<Index>> chunks;
+  for(size_t begin = 0; begin < count; begin += chunkSize)
+  {
+    chunks.emplace_back(std::async(launchPolicy(),
+      [&array, begin, end=std::min(begin + chunkSize, count)]()
+      {
+        Index index;
+        index.reserve(end - begin);
+        for(size_t i = begin; i < end; i++)
+        {
+          json& object = array[i];
+          auto it = object.find("id");
+          if(it == object.end())
+            throw std::runtime_error("id missing");
+          auto id = it.value().get<std::string>();
+          if(!isValidObjectId(id))
+            throw std::runtime_error("invalid object id value");
+          index.emplace_back(std::move(id), std::move(object));
+        }
+        return index;
+      }));
+  }
+
+  m_objects.reserve(m_objects.size() + count);
+  for(auto& chunk : chunks)
+    for(auto& [id, object] : chunk.get())
+      m_objects.insert({std::move(id), {std::move(object), nullptr, false}});
+}
+
 void WorldLoader::createObject(ObjectData& objectData)
 {
   assert(!objectData.object);
@@ -278,6 +405,21 @@ void WorldLoader::loadObject(ObjectData& objectData)
 
 bool WorldLoader::readFile(const std::filesystem::path& filename, std::string& data)
 {
+  if(auto it = m_journalFiles.find(filename.generic_string()); it != m_journalFiles.end())
+  {
+    if(!it->second)
+      return false; // deleted
+    data = *it->second;
+    return true;
+  }
+
+  if(auto it = m_files.find(filename.generic_string()); it != m_files.end())
+  {
+    data = std::move(it->second);
+    m_files.erase(it);
+    return true;
+  }
+
   if(m_ctw)
   {
     if(!m_ctw->readFile(filename, data))
@@ -295,3 +437,12 @@ bool WorldLoader::readFile(const std::filesystem::path& filename, std::string& d
   }
   return true;
 }
+
+std::string WorldLoader::takeLuaChunk(const std::filesystem::path& filename)
+{
+  const auto name = filename.generic_string();
+  if(m_journalFiles.count(name) != 0)
+    return {}; // code is changed since last save
+  auto node = m_luaChunks.extract(name);
+  return node ? std::move(node.mapped()) : std::string();
+}
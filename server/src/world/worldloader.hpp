@@ -23,6 +23,7 @@
 #ifndef TRAINTASTIC_SERVER_WORLD_WORLDLOADER_HPP
 #define TRAINTASTIC_SERVER_WORLD_WORLDLOADER_HPP
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,6 +31,7 @@
 #include <traintastic/utils/stdfilesystem.hpp>
 #include "../core/objectptr.hpp"
 #include "../utils/json.hpp"
+#include "worldjournal.hpp"
 
 class Object;
 class World;
@@ -45,19 +47,47 @@ class WorldLoader
       bool loaded;
     };
 
+    //! Read by a worker thread while the world data is parsed
+    struct Prefetched
+    {
+      nlohmann::json state;
+      std::unordered_map<std::string, std::string> files; //!< script code
+      std::unordered_map<std::string, std::string> luaChunks; //!< precompiled script code
+    };
+
+    static constexpr size_t indexChunkSizeMin = 1024; //!< minimum number of objects indexed by a worker
+
+    std::filesystem::path m_worldPath; //!< empty if loaded from memory
     std::filesystem::path m_path;
+    const std::vector<std::byte>* m_memory = nullptr;
     std::unique_ptr<CTWReader> m_ctw;
     std::shared_ptr<World> m_world;
     std::unordered_map<std::string, ObjectData> m_objects;
     nlohmann::json m_states;
+    WorldJournal::Files m_journalFiles;
+    std::unordered_map<std::string, std::string> m_files;
+    std::unordered_map<std::string, std::string> m_luaChunks;
+    size_t m_journalRecords = 0;
+
+    static std::launch launchPolicy();
 
     WorldLoader();
     void load();
+    Prefetched prefetch() const;
+    void buildIndex(nlohmann::json& objects);
 
     void createObject(ObjectData& objectData);
     void loadObject(ObjectData& objectData);
 
   public:
+#ifdef TRAINTASTIC_TEST
+    inline static bool parallel = true; //!< run all loading steps on the calling thread if \c false
+#endif
+
+    //! \brief Read world (state) file from a world directory
+    //! The binary (CBOR) file is used if it exists, else the JSON file.
+    static nlohmann::json readWorldFile(const std::filesystem::path& path, std::string_view filenameBinary, std::string_view filename);
+
     WorldLoader(std::filesystem::path path);
     WorldLoader(const std::vector<std::byte>& memory);
     ~WorldLoader();
@@ -68,6 +98,11 @@ class WorldLoader
     nlohmann::json getState(const std::string& id) const;
 
     bool readFile(const std::filesystem::path& filename, std::string& data);
+
+    //! \brief Get Lua chunk precompiled while loading
+    //! \param[in] filename Script code filename
+    //! \return Binary chunk, empty if not available
+    std::string takeLuaChunk(const std::filesystem::path& filename);
 };
 
 #endif
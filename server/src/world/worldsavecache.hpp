@@ -0,0 +1,97 @@
+/**
+ * server/src/world/worldsavecache.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_WORLDSAVECACHE_HPP
+#define TRAINTASTIC_SERVER_WORLD_WORLDSAVECACHE_HPP
+
+#include <list>
+#include <unordered_map>
+#include <traintastic/utils/stdfilesystem.hpp>
+#include "../core/objectptr.hpp"
+#include "../utils/json.hpp"
+
+class Object;
+
+//! \brief Serialized top level objects of a world
+//!
+//! Saving a world only serializes objects changed since the previous save, all other objects are taken from the cache.
+//! An entry is invalidated when a stored property of the object or one of its sub objects changes, see \ref WorldJournal::changed.
+//! A state change only invalidates the states of the entry, see \ref WorldStateCheckpoint::changed.
+class WorldSaveCache
+{
+  public:
+    struct Entry
+    {
+      std::weak_ptr<Object> object;
+      nlohmann::json data; //!< object data, or state data for a \ref StateObject
+      nlohmann::json states; //!< state of the object and its sub objects, by object id
+      std::list<std::filesystem::path> deleteFiles;
+      std::list<std::pair<std::filesystem::path, std::string>> writeFiles;
+      bool statesValid = true; //!< \c false if \ref states must be serialized again
+      bool filesSaved = false; //!< \ref writeFiles are part of a previous snapshot, see \ref WorldSaver::setPreviousPath
+    };
+
+  private:
+    std::unordered_map<const Object*, Entry> m_entries;
+
+  public:
+    size_t size() const
+    {
+      return m_entries.size();
+    }
+
+    const Entry* find(const ObjectPtr& object) const
+    {
+      if(auto it = m_entries.find(object.get()); it != m_entries.end() && it->second.object.lock() == object)
+        return &it->second;
+      return nullptr;
+    }
+
+    Entry* find(const ObjectPtr& object)
+    {
+      return const_cast<Entry*>(static_cast<const WorldSaveCache*>(this)->find(object));
+    }
+
+    Entry& store(const ObjectPtr& object, Entry entry)
+    {
+      entry.object = object;
+      return m_entries.insert_or_assign(object.get(), std::move(entry)).first->second;
+    }
+
+    void invalidate(const Object& object)
+    {
+      m_entries.erase(&object);
+    }
+
+    void invalidateStates(const Object& object)
+    {
+      if(auto it = m_entries.find(&object); it != m_entries.end())
+        it->second.statesValid = false;
+    }
+
+    void clear()
+    {
+      m_entries.clear();
+    }
+};
+
+#endif
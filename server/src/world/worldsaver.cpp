@@ -26,12 +26,24 @@
 #include <version.hpp>
 #include "world.hpp"
 #include "../core/stateobject.hpp"
-#include "../utils/sha1.hpp"
 #include "ctwwriter.hpp"
 
 using nlohmann::json;
 
-WorldSaver::WorldSaver(const World& world)
+WorldSaver::WorldSaver(const World& world, bool snapshot)
+  : m_snapshot{snapshot}
+{
+  save(world, false);
+}
+
+json WorldSaver::saveState(const World& world)
+{
+  WorldSaver saver;
+  saver.save(world, true);
+  return std::move(saver.m_state);
+}
+
+void WorldSaver::save(const World& world, bool stateOnly)
 {
   m_states = json::object();
   m_data = json::object();
@@ -69,18 +81,21 @@ WorldSaver::WorldSaver(const World& world)
     {
       if(ObjectPtr object = it.second.lock())
       {
-        if(auto stateObject = std::dynamic_pointer_cast<StateObject>(object))
+        auto& objectFragment = fragment(world, object);
+        if(!objectFragment.data.empty())
         {
-          json data = saveStateObject(stateObject);
-          if(!data.empty())
-            stateObjects.push_back(std::move(data));
+          if(std::dynamic_pointer_cast<StateObject>(object))
+            stateObjects.push_back(objectFragment.data);
+          else if(!stateOnly)
+            objects.push_back(objectFragment.data);
         }
-        else
+        if(stateOnly)
         {
-          json data = saveObject(object);
-          if(!data.empty())
-            objects.push_back(std::move(data));
+          for(const auto& [id, state] : objectFragment.states.items())
+            m_states[id] = state;
         }
+        else
+          splice(objectFragment);
       }
     }
 
@@ -96,34 +111,94 @@ WorldSaver::WorldSaver(const World& world)
   }
 }
 
-WorldSaver::WorldSaver(const World& world, const std::filesystem::path& path)
+WorldSaver::WorldSaver(const World& world, const std::filesystem::path& path, bool binary)
+  : WorldSaver(world)
+{
+  write(path, binary);
+}
+
+WorldSaver::WorldSaver(const World& world, std::vector<std::byte>& memory)
   : WorldSaver(world)
+{
+  CTWWriter ctw(memory);
+  writeCTW(ctw, false);
+}
+
+void WorldSaver::write(const std::filesystem::path& path, bool binary)
 {
   if(path.extension() == World::dotCTW)
   {
     CTWWriter ctw(path);
-    writeCTW(ctw);
+    writeCTW(ctw, binary);
   }
   else
   {
-    saveToDisk(m_data, path / World::filename);
-    saveToDisk(m_state, path / World::filenameState);
+    saveToDisk(m_data, path / (binary ? World::filenameBinary : World::filename));
+    saveToDisk(m_state, path / (binary ? World::filenameStateBinary : World::filenameState));
+
+    // remove files in the other format, the loader prefers the binary files:
+    deleteFile(binary ? World::filename : World::filenameBinary);
+    deleteFile(binary ? World::filenameState : World::filenameStateBinary);
+
     deleteFiles(path);
     writeFiles(path);
   }
 }
 
-WorldSaver::WorldSaver(const World& world, std::vector<std::byte>& memory)
-  : WorldSaver(world)
+WorldSaveCache::Entry& WorldSaver::fragment(const World& world, const ObjectPtr& object)
 {
-  CTWWriter ctw(memory);
-  writeCTW(ctw);
+  if(auto* entry = world.m_saveCache.find(object))
+  {
+    if(!entry->statesValid) // only the state changed, the data is still valid
+    {
+      WorldSaver saver;
+      saver.m_stateOnly = true;
+      saver.saveObject(object);
+      if(saver.m_states.is_object())
+        entry->states = std::move(saver.m_states);
+      else
+        entry->states = json::object();
+      entry->statesValid = true;
+    }
+    return *entry;
+  }
+
+  WorldSaver saver;
+  WorldSaveCache::Entry entry;
+  if(auto stateObject = std::dynamic_pointer_cast<StateObject>(object))
+    entry.data = saver.saveStateObject(stateObject);
+  else
+    entry.data = saver.saveObject(object);
+  if(saver.m_states.is_object())
+    entry.states = std::move(saver.m_states);
+  else
+    entry.states = json::object();
+  entry.deleteFiles = std::move(saver.m_deleteFiles);
+  entry.writeFiles = std::move(saver.m_writeFiles);
+  return world.m_saveCache.store(object, std::move(entry));
 }
 
-void WorldSaver::writeCTW(CTWWriter& ctw)
+void WorldSaver::splice(WorldSaveCache::Entry& objectFragment)
 {
-  ctw.writeFile(World::filename, m_data);
-  ctw.writeFile(World::filenameState, m_state);
+  for(const auto& [id, state] : objectFragment.states.items())
+    m_states[id] = state;
+  m_deleteFiles.insert(m_deleteFiles.end(), objectFragment.deleteFiles.begin(), objectFragment.deleteFiles.end());
+  m_writeFiles.insert(m_writeFiles.end(), objectFragment.writeFiles.begin(), objectFragment.writeFiles.end());
+
+  if(m_snapshot)
+  {
+    // the cache entry is replaced if the object changes, so the files are the same as written by the previous snapshot:
+    if(objectFragment.filesSaved)
+      for(const auto& file : objectFragment.writeFiles)
+        m_unchangedFiles.emplace(file.first);
+    objectFragment.filesSaved = true;
+  }
+}
+
+void WorldSaver::writeCTW(CTWWriter& ctw, bool binary)
+{
+  ctw.writeFile(binary ? World::filenameBinary : World::filename, m_data);
+  ctw.writeFile(binary ? World::filenameStateBinary : World::filenameState, m_state);
   for(const auto& file : m_writeFiles)
     ctw.writeFile(file.first, file.second);
 }
@@ -171,7 +246,26 @@ void WorldSaver::deleteFiles(const std::filesystem::path& basePath)
 void WorldSaver::writeFiles(const std::filesystem::path& basePath)
 {
   for(const auto& file : m_writeFiles)
+  {
+    if(!m_previousPath.empty() && m_unchangedFiles.count(file.first) != 0)
+    {
+      std::error_code ec;
+      if(m_previousPath == basePath)
+      {
+        if(std::filesystem::is_regular_file(basePath / file.first, ec))
+          continue; // still there
+      }
+      else
+      {
+        std::filesystem::create_directories((basePath / file.first).parent_path(), ec);
+        std::filesystem::create_hard_link(m_previousPath / file.first, basePath / file.first, ec);
+        if(!ec)
+          continue;
+      }
+      // missing or linking not supported, write it
+    }
     saveToDisk(file.second, basePath / file.first);
+  }
 }
 
 void WorldSaver::saveToDisk(const json& data, const std::filesystem::path& filename)
@@ -181,10 +275,13 @@ void WorldSaver::saveToDisk(const json& data, const std::filesystem::path& filen
   if(!std::filesystem::is_directory(dir))
     std::filesystem::create_directories(dir);
 
-  std::ofstream file(filename);
+  std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
   if(file.is_open())
   {
-    file << data.dump(2);
+    if(filename.extension() == World::dotCBOR)
+      nlohmann::json::to_cbor(data, file);
+    else
+      file << data.dump(2);
     //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
   }
   else
@@ -194,23 +291,24 @@ void WorldSaver::saveToDisk(const json& data, const std::filesystem::path& filen
 
 void WorldSaver::saveToDisk(const std::string& data, const std::filesystem::path& filename)
 {
-  if(std::filesystem::exists(filename) &&
-      std::filesystem::file_size(filename) == data.size() &&
-      Sha1::of(filename) == Sha1::of(data))
-    return;
-
   std::filesystem::path dir = std::filesystem::path(filename).remove_filename();
   std::string s = dir.string();
   if(!std::filesystem::is_directory(dir))
     std::filesystem::create_directories(dir);
 
-  std::ofstream file(filename);
-  if(file.is_open())
+  // write a new file instead of truncating, the existing file can be hard linked to a backup:
+  std::filesystem::path tmp = filename;
+  tmp += ".tmp";
   {
-    file << data;
-    //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
+    std::ofstream file(tmp);
+    if(file.is_open())
+    {
+      file << data;
+      //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
+    }
+    else
+      throw std::runtime_error("file not open");
+      //Traintastic::instance->console->critical(classId, "Can't write to world file");
   }
-  else
-    throw std::runtime_error("file not open");
-    //Traintastic::instance->console->critical(classId, "Can't write to world file");
+  std::filesystem::rename(tmp, filename);
 }
@@ -24,9 +24,11 @@
 #define TRAINTASTIC_SERVER_WORLD_WORLDSAVER_HPP
 
 #include <list>
+#include <set>
 #include "../core/objectptr.hpp"
 #include <traintastic/utils/stdfilesystem.hpp>
 #include "../utils/json.hpp"
+#include "worldsavecache.hpp"
 
 class World;
 class StateObject;
@@ -34,16 +36,30 @@ class CTWWriter;
 
 class WorldSaver
 {
+  friend class World;
+  friend class WorldJournal;
+
   private:
     nlohmann::json m_states;
     nlohmann::json m_data;
     nlohmann::json m_state;
     std::list<std::filesystem::path> m_deleteFiles;
     std::list<std::pair<std::filesystem::path, std::string>> m_writeFiles;
+    bool m_stateOnly = false; //!< only the states are used, see \ref isStateOnly
+    bool m_snapshot = false; //!< collected for a full save to a world directory, files are tracked in the cache
+    std::set<std::filesystem::path> m_unchangedFiles; //!< files in \ref m_writeFiles that are unchanged since the previous snapshot
+    std::filesystem::path m_previousPath; //!< see \ref setPreviousPath
+
+    WorldSaver() = default; //!< for saving single objects, see \ref WorldJournal
+    WorldSaver(const World& world, bool snapshot = false); //!< collects the world, see \ref write
+
+    void save(const World& world, bool stateOnly);
 
-    WorldSaver(const World& world);
+    //! \brief Get serialized object from cache, serializes and caches it if not cached
+    static WorldSaveCache::Entry& fragment(const World& world, const ObjectPtr& object);
+    void splice(WorldSaveCache::Entry& fragment);
 
-    void writeCTW(CTWWriter& ctw);
+    void writeCTW(CTWWriter& ctw, bool binary);
 
     void deleteFiles(const std::filesystem::path& basePath);
     void writeFiles(const std::filesystem::path& basePath);
@@ -51,9 +67,40 @@ class WorldSaver
     static void saveToDisk(const std::string& data, const std::filesystem::path& filename);
 
   public:
-    WorldSaver(const World& world, const std::filesystem::path& path);
+    //! \param[in] world World to save
+    //! \param[in] path World directory or CTW file
+    //! \param[in] binary Save world and state CBOR encoded instead of JSON text
+    WorldSaver(const World& world, const std::filesystem::path& path, bool binary = false);
     WorldSaver(const World& world, std::vector<std::byte>& memory);
 
+#ifdef TRAINTASTIC_TEST
+    //! \brief Save a snapshot like \ref World::save does, for testing
+    WorldSaver(const World& world, const std::filesystem::path& path, const std::filesystem::path& previousPath)
+      : WorldSaver(world, true)
+    {
+      setPreviousPath(previousPath);
+      write(path, false);
+    }
+#endif
+
+    //! \brief Write the collected world to disk
+    //! Doesn't access the world, so it can be called by another thread.
+    //! \param[in] path World directory or CTW file
+    //! \param[in] binary Save world and state CBOR encoded instead of JSON text
+    void write(const std::filesystem::path& path, bool binary);
+
+    //! \brief World directory holding the files of the previous snapshot
+    //! Unchanged files are hard linked from it instead of written, it can be the world directory
+    //! itself if it wasn't moved to the backup directory. Only used for snapshots.
+    void setPreviousPath(std::filesystem::path path) { m_previousPath = std::move(path); }
+
+    //! \brief Save world state only (traintastic.state.json)
+    static nlohmann::json saveState(const World& world);
+
+    //! \brief Only the states of the saved objects are used
+    //! Objects may skip serializing data that can't contain sub objects with state.
+    bool isStateOnly() const { return m_stateOnly; }
+
     nlohmann::json saveObject(const ObjectPtr& object);
     nlohmann::json saveStateObject(const std::shared_ptr<StateObject>& object);
 
@@ -0,0 +1,213 @@
+/**
+ * server/src/world/worldstatecheckpoint.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "worldstatecheckpoint.hpp"
+#include <cstdio>
+#ifdef WIN32
+  #include <io.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+#include "world.hpp"
+#include "worldjournal.hpp"
+#include "worldsaver.hpp"
+#include "../core/eventloop.hpp"
+#include "../core/stateobject.hpp"
+#include "../log/log.hpp"
+
+using nlohmann::json;
+
+std::filesystem::path WorldStateCheckpoint::filename(const std::filesystem::path& path)
+{
+  return std::filesystem::path(path).replace_extension(dotStateCheckpoint);
+}
+
+void WorldStateCheckpoint::changed(Object& object)
+{
+  World* world = nullptr;
+  if(Object* top = WorldJournal::topLevelObject(object, world))
+  {
+    // the data of a state object is its state:
+    if(dynamic_cast<StateObject*>(top))
+      world->m_saveCache.invalidate(*top);
+    else
+      world->m_saveCache.invalidateStates(*top);
+
+    if(world->m_stateCheckpoint && !world->m_stateCheckpoint->m_dirty)
+    {
+      world->m_stateCheckpoint->m_dirty = true;
+      world->m_stateCheckpoint->schedule();
+    }
+  }
+}
+
+WorldStateCheckpoint::WorldStateCheckpoint(World& world, const std::filesystem::path& worldPath)
+  : m_world{world}
+  , m_filename{filename(worldPath)}
+  , m_timer{EventLoop::ioContext}
+  , m_thread{&WorldStateCheckpoint::run, this}
+{
+}
+
+WorldStateCheckpoint::~WorldStateCheckpoint()
+{
+  if(m_scheduled)
+    m_timer.cancel();
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_one();
+  m_thread.join();
+}
+
+void WorldStateCheckpoint::checkpoint()
+{
+  if(!m_dirty || !m_world.m_journal)
+    return;
+
+  json state = WorldSaver::saveState(m_world);
+  json& journal = state["journal"] = json::object();
+  journal["id"] = m_world.m_journal->id();
+  journal["offset"] = m_world.m_journal->size();
+  m_dirty = false;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending = std::move(state); // replaces a not yet written checkpoint
+  }
+  m_condition.notify_one();
+}
+
+void WorldStateCheckpoint::flush()
+{
+  if(m_scheduled)
+  {
+    m_timer.cancel();
+    m_scheduled = false;
+  }
+
+  checkpoint();
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_condition.wait(lock,
+    [this]()
+    {
+      return !m_pending && !m_writing;
+    });
+}
+
+void WorldStateCheckpoint::schedule()
+{
+  if(m_scheduled)
+    return;
+
+  m_scheduled = true;
+  m_timer.expires_after(interval);
+  m_timer.async_wait(
+    [this](const boost::system::error_code& ec)
+    {
+      if(!ec)
+      {
+        m_scheduled = false;
+        checkpoint();
+      }
+    });
+}
+
+void WorldStateCheckpoint::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for(;;)
+  {
+    m_condition.wait(lock,
+      [this]()
+      {
+        return m_pending || m_stop;
+      });
+
+    if(!m_pending) // stop
+      break;
+
+    json state = std::move(*m_pending);
+    m_pending.reset();
+    m_writing = true;
+    lock.unlock();
+
+    write(state);
+
+    lock.lock();
+    m_writing = false;
+    m_condition.notify_all(); // wake up flush()
+  }
+}
+
+void WorldStateCheckpoint::write(const json& state)
+{
+  // write to temporary file and rename it, so a valid state file remains if writing fails:
+  std::filesystem::path tmpFilename = m_filename;
+  tmpFilename += ".tmp";
+
+  try
+  {
+    const std::vector<std::uint8_t> data = json::to_cbor(state);
+
+    std::FILE* file = std::fopen(tmpFilename.string().c_str(), "wb");
+    if(!file)
+      throw std::runtime_error("can't open " + tmpFilename.string());
+
+    // the checkpoint must be on disk before it replaces the previous one:
+    const bool written =
+      std::fwrite(data.data(), 1, data.size(), file) == data.size() &&
+      std::fflush(file) == 0 &&
+#ifdef WIN32
+      _commit(_fileno(file)) == 0;
+#else
+      fsync(fileno(file)) == 0;
+#endif
+    std::fclose(file);
+    if(!written)
+      throw std::runtime_error("write failed");
+
+    std::filesystem::rename(tmpFilename, m_filename);
+
+#ifndef WIN32
+    // make the rename durable:
+    if(int fd = open(m_filename.parent_path().string().c_str(), O_RDONLY); fd >= 0)
+    {
+      fsync(fd);
+      close(fd);
+    }
+#endif
+  }
+  catch(const std::exception& e)
+  {
+    EventLoop::call(
+      [world=std::weak_ptr<Object>(m_world.weak_from_this()), what=std::string(e.what())]()
+      {
+        if(auto w = world.lock())
+          Log::log(*w, LogMessage::E1010_WRITING_WORLD_STATE_CHECKPOINT_FAILED_X, what);
+      });
+  }
+}
@@ -0,0 +1,102 @@
+/**
+ * server/src/world/worldstatecheckpoint.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_WORLDSTATECHECKPOINT_HPP
+#define TRAINTASTIC_SERVER_WORLD_WORLDSTATECHECKPOINT_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <boost/asio/steady_timer.hpp>
+#include <traintastic/utils/stdfilesystem.hpp>
+#include "../utils/json.hpp"
+
+class Object;
+class World;
+
+//! \brief Periodic checkpoint of the world state
+//!
+//! State changes (\ref PropertyFlags::StoreState properties and \ref StateObject "state objects")
+//! change often while trains are running, they aren't journaled but written as a complete world
+//! state at most once every \ref interval. The state is collected on the event loop, encoding and
+//! writing it is done by a background thread. The checkpoint is written next to the world directory
+//! or CTW file, the saved world itself is left untouched.
+//!
+//! The checkpoint includes the journal position, so the journal can be replayed on top of it, see
+//! \ref WorldJournal::replay.
+class WorldStateCheckpoint
+{
+  public:
+    static constexpr std::string_view dotStateCheckpoint = ".state.cbor";
+
+    //! Minimum time between two checkpoints.
+    static constexpr auto interval = std::chrono::seconds(5);
+
+  private:
+    World& m_world;
+    const std::filesystem::path m_filename;
+    boost::asio::steady_timer m_timer;
+    bool m_scheduled = false;
+    bool m_dirty = false;
+
+    // shared with background thread:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::optional<nlohmann::json> m_pending;
+    bool m_writing = false;
+    bool m_stop = false;
+    std::thread m_thread;
+
+    void schedule();
+    void run();
+    void write(const nlohmann::json& state);
+
+  public:
+    //! \brief Get checkpoint filename for a world
+    //! \param[in] path World directory or CTW file
+    //! \return Checkpoint file next to the world directory or CTW file
+    static std::filesystem::path filename(const std::filesystem::path& path);
+
+    //! \brief Mark state of object as changed
+    //! Looks up the world the object belongs to, does nothing if it hasn't a checkpoint.
+    static void changed(Object& object);
+
+    //! \param[in] world World to checkpoint, must have a journal
+    //! \param[in] worldPath World directory or CTW file
+    WorldStateCheckpoint(World& world, const std::filesystem::path& worldPath);
+
+    //! Waits for a checkpoint being written, doesn't write pending changes, see \ref flush.
+    ~WorldStateCheckpoint();
+
+    WorldStateCheckpoint(const WorldStateCheckpoint&) = delete;
+    WorldStateCheckpoint& operator =(const WorldStateCheckpoint&) = delete;
+
+    //! \brief Collect world state and queue it for writing
+    void checkpoint();
+
+    //! \brief Write pending state changes and wait until they're on disk
+    void flush();
+};
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * server/test/board/blockpathconflicts.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/map/blockpath.hpp"
+#include "../src/board/map/blockpathconflicts.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+
+TEST_CASE("BlockPathConflicts: paths sharing tiles conflict", "[board][board-blockpath]")
+{
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  world->edit = true;
+
+  // two separate tracks, each with two blocks:
+  for(const int16_t x : {0, 4})
+  {
+    REQUIRE(board->addTile(x, 0, TileRotate::Deg0, BlockRailTile::classId, false));
+    REQUIRE(board->addTile(x, 1, TileRotate::Deg0, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(x, 2, TileRotate::Deg0, BlockRailTile::classId, false));
+  }
+
+  world->edit = false;
+
+  auto blockPath =
+    [&board](int16_t x, int16_t y)
+    {
+      auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({x, y}));
+      REQUIRE(block);
+      REQUIRE(block->paths().size() == 1);
+      return block->paths().front();
+    };
+
+  const auto down = blockPath(0, 0);
+  const auto up = blockPath(0, 2);
+  const auto other = blockPath(4, 0);
+
+  auto& conflicts = world->blockPathConflicts();
+  REQUIRE(conflicts.conflicts(*down, *up));
+  REQUIRE(conflicts.conflicts(*up, *down));
+  REQUIRE_FALSE(conflicts.conflicts(*down, *other));
+  REQUIRE_FALSE(conflicts.conflicts(*down, *down));
+
+  REQUIRE(down->isFree());
+  conflicts.reserved(*up);
+  REQUIRE_FALSE(down->isFree());
+  REQUIRE(other->isFree());
+  conflicts.released(*up);
+  REQUIRE(down->isFree());
+
+  // removing the shared tile removes the paths and their conflicts:
+  conflicts.reserved(*up);
+  world->edit = true;
+  REQUIRE(board->deleteTile(0, 1));
+  world->edit = false;
+  REQUIRE_FALSE(conflicts.conflicts(*other, *up));
+  REQUIRE(other->isFree());
+}
@@ -0,0 +1,76 @@
+/**
+ * server/test/board/blockroutes.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/map/blockpath.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+
+TEST_CASE("BlockRoutes: find route", "[board][board-blockroutes]")
+{
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  // block - straight - block - straight - block:
+  world->edit = true;
+  for(int16_t y = 0; y <= 4; y++)
+    REQUIRE(board->addTile(0, y, TileRotate::Deg0, (y % 2 == 0) ? BlockRailTile::classId : StraightRailTile::classId, false));
+  world->edit = false;
+
+  auto block =
+    [&board](int16_t y)
+    {
+      auto tile = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, y}));
+      REQUIRE(tile);
+      return tile;
+    };
+
+  {
+    const auto route = board->findRoute(*block(0), *block(4));
+    REQUIRE(route.paths.size() == 2);
+    REQUIRE(route.cost == 2.0);
+    REQUIRE(&route.paths[0]->fromBlock() == block(0).get());
+    REQUIRE(route.paths[0]->toBlock() == block(2));
+    REQUIRE(route.paths[1]->toBlock() == block(4));
+  }
+
+  REQUIRE(board->findRoute(*block(4), *block(0)).paths.size() == 2);
+  REQUIRE(board->findRoute(*block(0), *block(0)).empty());
+
+  // cached route is discarded when a path is removed:
+  world->edit = true;
+  REQUIRE(board->deleteTile(0, 3));
+  world->edit = false;
+  REQUIRE(board->findRoute(*block(0), *block(4)).empty());
+  REQUIRE(board->findRoute(*block(0), *block(2)).paths.size() == 1);
+
+  // and when a path is added:
+  world->edit = true;
+  REQUIRE(board->addTile(0, 3, TileRotate::Deg0, StraightRailTile::classId, false));
+  world->edit = false;
+  REQUIRE(board->findRoute(*block(0), *block(4)).paths.size() == 2);
+}
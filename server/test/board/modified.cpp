@@ -0,0 +1,140 @@
+/**
+ * server/test/board/modified.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+#include "../src/board/tile/rail/linkrailtile.hpp"
+#include "../src/board/map/blockpath.hpp"
+
+TEST_CASE("Board: Modified region", "[board][board-modified]")
+{
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  world->edit = true;
+
+  // two separate tracks, each with two blocks:
+  for(const int16_t x : {0, 4})
+  {
+    REQUIRE(board->addTile(x, 0, TileRotate::Deg0, BlockRailTile::classId, false));
+    REQUIRE(board->addTile(x, 1, TileRotate::Deg0, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(x, 2, TileRotate::Deg0, BlockRailTile::classId, false));
+  }
+
+  auto blockPaths =
+    [&board](int16_t x, int16_t y)
+    {
+      auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({x, y}));
+      REQUIRE(block);
+      return block->paths();
+    };
+
+  world->edit = false;
+  REQUIRE(blockPaths(0, 0).size() == 1);
+  REQUIRE(blockPaths(0, 2).size() == 1);
+  REQUIRE(blockPaths(4, 0).size() == 1);
+  const auto otherPath = blockPaths(4, 0).front();
+
+  // break the first track:
+  world->edit = true;
+  REQUIRE(board->deleteTile(0, 1));
+  world->edit = false;
+  REQUIRE(blockPaths(0, 0).empty());
+  REQUIRE(blockPaths(0, 2).empty());
+  REQUIRE(blockPaths(4, 0).size() == 1);
+  REQUIRE(blockPaths(4, 0).front() == otherPath);
+
+  // and repair it by moving a block:
+  world->edit = true;
+  REQUIRE(board->moveTile(0, 2, 0, 1, TileRotate::Deg0, false));
+  world->edit = false;
+  REQUIRE(blockPaths(0, 0).size() == 1);
+  REQUIRE(blockPaths(0, 1).size() == 1);
+  REQUIRE(blockPaths(4, 0).size() == 1);
+  REQUIRE(blockPaths(4, 0).front() == otherPath);
+}
+
+TEST_CASE("Board: Modified link", "[board][board-modified]")
+{
+  auto world = World::create();
+
+  world->edit = true;
+
+  // three boards, each with a link to a block:
+  std::vector<std::shared_ptr<LinkRailTile>> links;
+  std::vector<std::shared_ptr<BlockRailTile>> blocks;
+  for(int i = 0; i < 3; i++)
+  {
+    auto board = world->boards->create();
+    REQUIRE(board->addTile(0, 0, TileRotate::Deg0, LinkRailTile::classId, false));
+    REQUIRE(board->addTile(0, 1, TileRotate::Deg0, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(0, 2, TileRotate::Deg0, BlockRailTile::classId, false));
+    links.emplace_back(std::dynamic_pointer_cast<LinkRailTile>(board->getTile({0, 0})));
+    blocks.emplace_back(std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, 2})));
+    REQUIRE(links.back());
+    REQUIRE(blocks.back());
+  }
+
+  auto pathTo =
+    [&blocks](size_t from) -> std::shared_ptr<BlockRailTile>
+    {
+      const auto& paths = blocks[from]->paths();
+      if(paths.empty())
+        return {};
+      REQUIRE(paths.size() == 1);
+      return paths.front()->toBlock();
+    };
+
+  world->edit = false;
+  REQUIRE_FALSE(pathTo(0));
+  REQUIRE_FALSE(pathTo(1));
+  REQUIRE_FALSE(pathTo(2));
+
+  world->edit = true;
+  links[0]->link = links[1];
+  world->edit = false;
+  REQUIRE(pathTo(0) == blocks[1]);
+  REQUIRE(pathTo(1) == blocks[0]);
+  REQUIRE_FALSE(pathTo(2));
+
+  // re-pair, the old pair must be unlinked:
+  world->edit = true;
+  links[2]->link = links[0];
+  world->edit = false;
+  REQUIRE(links[1]->link.value() == nullptr);
+  REQUIRE(pathTo(0) == blocks[2]);
+  REQUIRE_FALSE(pathTo(1));
+  REQUIRE(pathTo(2) == blocks[0]);
+
+  world->edit = true;
+  links[0]->link = nullptr;
+  world->edit = false;
+  REQUIRE_FALSE(pathTo(0));
+  REQUIRE_FALSE(pathTo(1));
+  REQUIRE_FALSE(pathTo(2));
+}
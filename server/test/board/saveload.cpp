@@ -24,6 +24,7 @@
 #include "../src/world/world.hpp"
 #include "../src/world/worldloader.hpp"
 #include "../src/world/worldsaver.hpp"
+#include "../src/world/worldjournal.hpp"
 #include "../src/core/method.tpp"
 #include "../src/core/objectproperty.tpp"
 #include "../src/board/board.hpp"
@@ -83,4 +84,5 @@ TEST_CASE("Board: Save/Load", "[board][board-saveload]")
 
   INFO("Remove saved world");
   REQUIRE(std::filesystem::remove(ctw));
+  REQUIRE(std::filesystem::remove(WorldJournal::filename(ctw)));
 }
@@ -0,0 +1,103 @@
+/**
+ * server/test/board/signalevaluator.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/map/signalevaluator.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+#include "../src/board/tile/rail/signal/signal2aspectrailtile.hpp"
+
+TEST_CASE("SignalEvaluator: signal is evaluated once per pass", "[board][board-signal]")
+{
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  world->edit = true;
+  REQUIRE(board->addTile(0, 0, TileRotate::Deg0, BlockRailTile::classId, false));
+  REQUIRE(board->addTile(0, 1, TileRotate::Deg0, Signal2AspectRailTile::classId, false));
+  REQUIRE(board->addTile(0, 2, TileRotate::Deg0, BlockRailTile::classId, false));
+  world->edit = false;
+
+  auto& evaluator = world->signalEvaluator();
+  evaluator.evaluate(); // board modified schedules all signals
+  REQUIRE(evaluator.evaluations() == 1);
+
+  auto signal = std::dynamic_pointer_cast<Signal2AspectRailTile>(board->getTile({0, 1}));
+  REQUIRE(signal);
+  REQUIRE(signal->aspect.value() != SignalAspect::Unknown);
+
+  // the signal depends on one of the blocks, only that block marks it dirty, a free block is evaluated later:
+  const auto saved = evaluator.evaluationsSaved();
+  for(const int16_t y : {0, 2})
+  {
+    auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, y}));
+    REQUIRE(block);
+    for(int i = 0; i < 3; i++)
+      block->stateChanged(*block, BlockState::Free);
+  }
+  REQUIRE(evaluator.evaluationsSaved() == saved + 2);
+  REQUIRE(evaluator.evaluations() == 1);
+
+  evaluator.evaluate();
+  REQUIRE(evaluator.evaluations() == 2);
+
+  evaluator.evaluate(); // nothing dirty
+  REQUIRE(evaluator.evaluations() == 2);
+
+  // an occupied block is evaluated immediately:
+  for(const int16_t y : {0, 2})
+  {
+    auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, y}));
+    block->stateChanged(*block, BlockState::Occupied);
+  }
+  REQUIRE(evaluator.evaluations() == 3);
+
+  // unless deferred:
+  {
+    SignalEvaluator::Defer defer(evaluator);
+    for(const int16_t y : {0, 2})
+    {
+      auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, y}));
+      for(int i = 0; i < 3; i++)
+        block->stateChanged(*block, BlockState::Reserved);
+    }
+    REQUIRE(evaluator.evaluations() == 3);
+  }
+  REQUIRE(evaluator.evaluations() == 4);
+
+  // removing the signal removes its dependencies:
+  world->edit = true;
+  signal.reset();
+  REQUIRE(board->deleteTile(0, 1));
+  world->edit = false;
+  for(const int16_t y : {0, 2})
+  {
+    auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, y}));
+    block->stateChanged(*block, block->state.value());
+  }
+  evaluator.evaluate();
+  REQUIRE(evaluator.evaluations() == 2);
+}
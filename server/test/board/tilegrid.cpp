@@ -0,0 +1,112 @@
+/**
+ * server/test/board/tilegrid.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/tilegrid.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+
+namespace {
+
+std::vector<std::shared_ptr<Tile>> createTiles(World& world, size_t count)
+{
+  auto board = world.boards->create();
+  std::vector<std::shared_ptr<Tile>> tiles;
+  for(size_t i = 0; i < count; i++)
+  {
+    REQUIRE(board->addTile(static_cast<int16_t>(i), 0, TileRotate::Deg0, StraightRailTile::classId, false));
+    tiles.emplace_back(board->getTile({static_cast<int16_t>(i), 0}));
+  }
+  return tiles;
+}
+
+}
+
+TEST_CASE("TileGrid: multi cell tiles across chunks", "[board][board-tilegrid]")
+{
+  auto world = World::create();
+  const auto tiles = createTiles(*world, 3);
+
+  TileGrid grid;
+  REQUIRE(grid.empty());
+
+  grid.insert(tiles[0], {-1, -1}, 1, 1);
+  grid.insert(tiles[1], {14, 0}, 4, 1); // crosses a chunk border
+  grid.insert(tiles[2], {0, -20}, 1, 40); // crosses three chunk rows
+  REQUIRE(grid.size() == 3);
+
+  REQUIRE(grid.get({-1, -1}) == tiles[0]);
+  for(int16_t x = 14; x < 18; x++)
+    REQUIRE(grid.get({x, 0}) == tiles[1]);
+  REQUIRE_FALSE(grid.contains({18, 0}));
+  REQUIRE(grid.get({0, 19}) == tiles[2]);
+  REQUIRE_FALSE(grid.contains({1, 1}));
+
+  TileLocation min;
+  TileLocation max;
+  REQUIRE(grid.bounds(min, max));
+  REQUIRE(min == TileLocation{-1, -20});
+  REQUIRE(max == TileLocation{17, 19});
+
+  // each tile once, in chunk order:
+  std::vector<std::shared_ptr<Tile>> visited;
+  grid.forEach(
+    [&visited](const std::shared_ptr<Tile>& tile)
+    {
+      visited.emplace_back(tile);
+    });
+  REQUIRE(visited == std::vector<std::shared_ptr<Tile>>{tiles[2], tiles[0], tiles[1]});
+
+  // rectangle, reports tiles with their origin outside the rectangle:
+  visited.clear();
+  grid.forEach(TileLocation{0, -1}, TileLocation{16, 0},
+    [&visited](const std::shared_ptr<Tile>& tile)
+    {
+      visited.emplace_back(tile);
+    });
+  REQUIRE(visited.size() == 2);
+
+  // chunk, only tiles with their origin in it:
+  visited.clear();
+  grid.forEach(TileChunk{1, 0},
+    [&visited](const std::shared_ptr<Tile>& tile)
+    {
+      visited.emplace_back(tile);
+    });
+  REQUIRE(visited.empty());
+
+  grid.erase({14, 0}, 4, 1);
+  REQUIRE(grid.size() == 2);
+  REQUIRE_FALSE(grid.contains({16, 0}));
+  REQUIRE(grid.get({0, 0}) == tiles[2]);
+
+  grid.erase({0, -20}, 1, 40);
+  grid.erase({-1, -1}, 1, 1);
+  REQUIRE(grid.empty());
+  REQUIRE_FALSE(grid.bounds(min, max));
+  REQUIRE(grid.memoryUsage() == sizeof(TileGrid));
+}
@@ -0,0 +1,156 @@
+/**
+ * server/test/core/eventloopqueue.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <vector>
+#include "../../src/core/eventloopqueue.hpp"
+#include "../../src/core/eventloop.hpp"
+
+TEST_CASE("EventLoopQueue: calls are executed in order", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  EventLoopQueue queue(ioContext);
+  std::vector<int> order;
+
+  for(int i = 0; i < 10; i++)
+    queue.call([&order, i]() { order.push_back(i); });
+
+  REQUIRE(order.empty());
+  REQUIRE(ioContext.poll() == 1); // single drain handler for all calls
+  REQUIRE(order == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST_CASE("EventLoopQueue: large callable", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  EventLoopQueue queue(ioContext);
+  std::array<char, EventLoopQueue::storageSize * 2> data;
+  data.fill('x');
+  std::string result;
+
+  queue.call([&result, data]() { result.assign(data.begin(), data.end()); });
+
+  REQUIRE(ioContext.poll() == 1);
+  REQUIRE(result == std::string(data.size(), 'x'));
+}
+
+TEST_CASE("EventLoopQueue: call queued while draining", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  EventLoopQueue queue(ioContext);
+  int count = 0;
+
+  queue.call(
+    [&]()
+    {
+      count++;
+      queue.call([&count]() { count++; });
+    });
+
+  REQUIRE(ioContext.poll() == 1); // handled by the same drain handler
+  REQUIRE(count == 2);
+}
+
+TEST_CASE("EventLoopQueue: drain handler is posted again after max calls", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  EventLoopQueue queue(ioContext);
+  size_t count = 0;
+
+  std::function<void()> requeue =
+    [&]()
+    {
+      if(++count < 2 * EventLoopQueue::drainCallsMax)
+        queue.call(requeue);
+    };
+  queue.call(requeue);
+
+  REQUIRE(ioContext.poll_one() == 1);
+  REQUIRE(count == EventLoopQueue::drainCallsMax);
+  REQUIRE(ioContext.poll_one() == 1);
+  REQUIRE(count == 2 * EventLoopQueue::drainCallsMax);
+  REQUIRE(ioContext.poll_one() == 0);
+}
+
+TEST_CASE("EventLoopQueue: max calls is applied within a batch", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  EventLoopQueue queue(ioContext);
+  std::vector<size_t> order;
+
+  for(size_t i = 0; i < EventLoopQueue::drainCallsMax + 10; i++)
+    queue.call([&order, i]() { order.push_back(i); });
+
+  REQUIRE(ioContext.poll_one() == 1);
+  REQUIRE(order.size() == EventLoopQueue::drainCallsMax);
+
+  queue.call([&order]() { order.push_back(0); });
+
+  REQUIRE(ioContext.poll_one() == 1);
+  REQUIRE(order.size() == EventLoopQueue::drainCallsMax + 11);
+  REQUIRE(order[EventLoopQueue::drainCallsMax + 9] == EventLoopQueue::drainCallsMax + 9); // remaining calls are handled first
+  REQUIRE(order.back() == 0);
+}
+
+TEST_CASE("EventLoopQueue: throwing call doesn't stall the queue", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  EventLoopQueue queue(ioContext);
+  int count = 0;
+  const uint32_t queueDepth = EventLoop::statistics.queueDepth();
+
+  queue.call([]() { throw std::runtime_error("call"); });
+  queue.call([&count]() { count++; });
+
+  REQUIRE_THROWS_AS(ioContext.poll_one(), std::runtime_error);
+  REQUIRE(count == 0);
+  REQUIRE(ioContext.poll_one() == 1); // posted again
+  REQUIRE(count == 1);
+
+  ioContext.restart(); // ran out of work
+  queue.call([&count]() { count++; });
+  REQUIRE(ioContext.poll_one() == 1);
+  REQUIRE(count == 2);
+  REQUIRE(EventLoop::statistics.queueDepth() == queueDepth);
+}
+
+TEST_CASE("EventLoopQueue: calls are discarded when queue is destroyed", "[eventloopqueue]")
+{
+  boost::asio::io_context ioContext;
+  auto owner = std::make_shared<int>(0);
+  std::weak_ptr<int> ownerWeak = owner;
+  bool called = false;
+  const uint32_t queueDepth = EventLoop::statistics.queueDepth();
+
+  {
+    EventLoopQueue queue(ioContext);
+    queue.call([owner, &called]() { called = true; });
+    owner.reset();
+    REQUIRE_FALSE(ownerWeak.expired());
+  }
+
+  REQUIRE(ownerWeak.expired());
+  REQUIRE(EventLoop::statistics.queueDepth() == queueDepth);
+  ioContext.poll();
+  REQUIRE_FALSE(called);
+}
@@ -0,0 +1,148 @@
+/**
+ * server/test/core/objectlisttablemodel.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <tuple>
+#include <vector>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/objectlisttablemodel.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainlist.hpp"
+
+namespace {
+
+constexpr uint32_t columnName = 1;
+
+using RowChange = std::tuple<TableModelRowChange, uint32_t, uint32_t>;
+
+std::vector<std::string> names(const TableModel& model)
+{
+  std::vector<std::string> result;
+  for(uint32_t row = 0; row < model.rowCount(); row++)
+    result.emplace_back(model.getText(columnName, row));
+  return result;
+}
+
+std::vector<std::string> rowIds(const TableModel& model)
+{
+  std::vector<std::string> result;
+  for(uint32_t row = 0; row < model.rowCount(); row++)
+    result.emplace_back(model.getRowId(row));
+  return result;
+}
+
+}
+
+TEST_CASE("ObjectListTableModel: sort and filter", "[objectlisttablemodel]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  auto charlie = world->boards->create();
+  auto alpha = world->boards->create();
+  auto bravo = world->boards->create();
+  charlie->name.setValueInternal("Charlie");
+  alpha->name.setValueInternal("Alpha");
+  bravo->name.setValueInternal("Bravo");
+
+  TableModelPtr model = world->boards->getModel();
+  std::vector<RowChange> changes;
+  model->rowsChangedIncremental =
+    [&changes](const TableModelPtr&, TableModelRowChange change, uint32_t row, uint32_t value)
+    {
+      changes.emplace_back(change, row, value);
+    };
+  uint32_t rowCount = model->rowCount();
+  model->rowCountChanged =
+    [&rowCount](const TableModelPtr& tableModel)
+    {
+      rowCount = tableModel->rowCount();
+    };
+  model->setRegion({0, 1, 0, 9});
+  REQUIRE(names(*model) == std::vector<std::string>{"Charlie", "Alpha", "Bravo"});
+
+  model->setSortFilter(columnName, false, {});
+  REQUIRE(names(*model) == std::vector<std::string>{"Alpha", "Bravo", "Charlie"});
+  REQUIRE(rowIds(*model) == std::vector<std::string>{alpha->id, bravo->id, charlie->id});
+
+  // changed row is moved to its new position:
+  changes.clear();
+  alpha->name.setValueInternal("Delta");
+  REQUIRE(changes == std::vector<RowChange>{{TableModelRowChange::Move, 0, 2}});
+  REQUIRE(names(*model) == std::vector<std::string>{"Bravo", "Charlie", "Delta"});
+
+  model->setSortFilter(columnName, true, {});
+  REQUIRE(names(*model) == std::vector<std::string>{"Delta", "Charlie", "Bravo"});
+
+  // filter is case insensitive and keeps list order if not sorted:
+  model->setSortFilter(TableModel::noSortColumn, false, "rav");
+  REQUIRE(names(*model) == std::vector<std::string>{"Bravo"});
+
+  changes.clear();
+  charlie->name.setValueInternal("Ravioli");
+  REQUIRE(changes == std::vector<RowChange>{{TableModelRowChange::Insert, 0, 1}});
+  REQUIRE(names(*model) == std::vector<std::string>{"Ravioli", "Bravo"});
+
+  REQUIRE(rowCount == 2);
+
+  changes.clear();
+  world->boards->create(); // not matching filter
+  REQUIRE(changes.empty());
+  REQUIRE(model->rowCount() == 2);
+
+  changes.clear();
+  world->boards->removeObject(charlie);
+  REQUIRE(changes == std::vector<RowChange>{{TableModelRowChange::Remove, 0, 1}});
+  REQUIRE(names(*model) == std::vector<std::string>{"Bravo"});
+  REQUIRE(rowCount == 1);
+
+  model->setSortFilter(TableModel::noSortColumn, false, {});
+  REQUIRE(model->rowCount() == 3);
+  REQUIRE(rowCount == 3);
+}
+
+TEST_CASE("ObjectListTableModel: sort on typed key", "[objectlisttablemodel]")
+{
+  constexpr uint32_t columnWeight = 5;
+
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  auto heavy = world->trains->create();
+  auto light = world->trains->create();
+  auto medium = world->trains->create();
+  heavy->weight.setValueInternal(10, WeightUnit::Ton);
+  light->weight.setValueInternal(900, WeightUnit::KiloGram);
+  medium->weight.setValueInternal(2, WeightUnit::Ton);
+
+  TableModelPtr model = world->trains->getModel();
+  model->setSortFilter(columnWeight, false, {});
+  REQUIRE(rowIds(*model) == std::vector<std::string>{light->id, medium->id, heavy->id});
+
+  // numbers sort before texts:
+  REQUIRE(TableModel::compareSortKey(9., 10.) < 0);
+  REQUIRE(TableModel::compareSortKey(10., std::string("9")) < 0);
+  REQUIRE(TableModel::compareSortKey(std::string("b"), std::string("A")) > 0);
+}
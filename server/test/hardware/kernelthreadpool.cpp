@@ -0,0 +1,70 @@
+/**
+ * server/test/hardware/kernelthreadpool.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <future>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/hardware/protocol/kernelthreadpool.hpp"
+
+TEST_CASE("KernelThreadPool: kernels are spread over the threads", "[kernelthreadpool]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  KernelThreadPool pool(2, false);
+  REQUIRE(pool.threadCount() == 2);
+
+  auto& worker1 = pool.acquire();
+  auto& worker2 = pool.acquire();
+  REQUIRE(&worker1 != &worker2);
+  REQUIRE(worker1.thread.get_id() != worker2.thread.get_id());
+
+  pool.release(worker1);
+  REQUIRE(&pool.acquire() == &worker1);
+
+  // handlers run in the worker thread:
+  std::promise<std::thread::id> threadId;
+  worker2.ioContext.post(
+    [&threadId]()
+    {
+      threadId.set_value(std::this_thread::get_id());
+    });
+  REQUIRE(threadId.get_future().get() == worker2.thread.get_id());
+
+  pool.release(worker1);
+  pool.release(worker2);
+}
+
+TEST_CASE("KernelThreadPool: shared instance", "[kernelthreadpool]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  KernelThreadPool::config.threadCount = 3;
+  std::weak_ptr<KernelThreadPool> poolWeak;
+  {
+    auto pool = KernelThreadPool::get();
+    REQUIRE(pool->threadCount() == 3);
+    REQUIRE(KernelThreadPool::get() == pool);
+    poolWeak = pool;
+  }
+  REQUIRE(poolWeak.expired());
+  KernelThreadPool::config = KernelThreadPoolConfig();
+}
@@ -0,0 +1,68 @@
+/**
+ * server/test/network/message.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <traintastic/network/message.hpp>
+
+TEST_CASE("Message: write and read", "[network][message]")
+{
+  auto message = Message::newEvent(Message::Command::ObjectPropertyChanged);
+  message->write<uint32_t>(42);
+  message->write(std::string_view("name"));
+  message->write(std::string("value"));
+  message->write(true);
+
+  Message received(*reinterpret_cast<const Message::Header*>(**message));
+  std::memcpy(received.data(), message->data(), message->dataSize());
+
+  REQUIRE(received.read<uint32_t>() == 42);
+  const auto name = received.read<std::string_view>();
+  REQUIRE(name == "name");
+  REQUIRE(name.data() == static_cast<const char*>(received.data()) + sizeof(uint32_t) + sizeof(Message::Length)); // borrowed, not copied
+  REQUIRE(received.read<std::string>() == "value");
+  REQUIRE(received.read<bool>());
+  REQUIRE(received.endOfMessage());
+}
+
+TEST_CASE("Message: buffer is reused", "[network][message]")
+{
+  const void* data;
+  {
+    auto message = Message::newEvent(Message::Command::ObjectPropertyChanged, 100);
+    data = **message;
+  }
+  REQUIRE(Message::bufferPool.size() != 0);
+
+  auto message = Message::newEvent(Message::Command::ObjectPropertyChanged);
+  REQUIRE(**message == data);
+  REQUIRE(message->size() == sizeof(Message::Header));
+  REQUIRE(message->dataSize() == 0);
+}
+
+TEST_CASE("Message: large buffer isn't reused", "[network][message]")
+{
+  const size_t poolSize = Message::bufferPool.size();
+  {
+    Message message(static_cast<uint32_t>(MessageBufferPool::capacityMax + 1));
+  }
+  REQUIRE(Message::bufferPool.size() == poolSize);
+}
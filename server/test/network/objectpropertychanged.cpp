@@ -0,0 +1,63 @@
+/**
+ * server/test/network/objectpropertychanged.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <cstring>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/network/session.hpp"
+#include "../../src/world/world.hpp"
+
+namespace {
+
+//! Compare messages, except for the object handle
+bool equalExceptHandle(const Message& a, const Message& b)
+{
+  constexpr size_t handleOffset = sizeof(Message::Header);
+  constexpr size_t tailOffset = handleOffset + sizeof(uint32_t);
+  return
+    a.size() == b.size() &&
+    std::memcmp(*a, *b, handleOffset) == 0 &&
+    std::memcmp(static_cast<const uint8_t*>(*a) + tailOffset, static_cast<const uint8_t*>(*b) + tailOffset, a.size() - tailOffset) == 0;
+}
+
+}
+
+TEST_CASE("Shared object property changed event", "[network][session]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  world->name.setValueInternal("first");
+
+  auto shared = Session::sharedObjectPropertyChangedEvent(world->name);
+  REQUIRE(shared);
+  REQUIRE(equalExceptHandle(*shared, *Session::newObjectPropertyChangedEvent(42, world->name)));
+  REQUIRE(Session::sharedObjectPropertyChangedEvent(world->name) == shared); // encoded once
+
+  world->name.setValueInternal("second");
+  auto sharedSecond = Session::sharedObjectPropertyChangedEvent(world->name);
+  REQUIRE(sharedSecond != shared); // encoded again after change
+  REQUIRE(equalExceptHandle(*sharedSecond, *Session::newObjectPropertyChangedEvent(42, world->name)));
+  REQUIRE_FALSE(equalExceptHandle(*sharedSecond, *shared));
+
+  REQUIRE(Session::sharedObjectPropertyChangedEvent(world->scaleRatio) != sharedSecond); // other property
+}
@@ -0,0 +1,64 @@
+/**
+ * server/test/world/ctwreader.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../../src/world/ctwreader.hpp"
+#include "../../src/world/ctwwriter.hpp"
+
+TEST_CASE("CTWReader: read entries in any order", "[world][ctw]")
+{
+  std::vector<std::byte> memory;
+  {
+    CTWWriter ctw(memory);
+    ctw.writeFile("data.json", nlohmann::json{{"name", "json"}});
+    ctw.writeFile("data.cbor", nlohmann::json{{"name", "cbor"}});
+    ctw.writeFile("script/1.lua", std::string("-- one"));
+    ctw.writeFile("script/2.lua", std::string("-- two"));
+  }
+
+  CTWReader ctw(memory);
+  std::string text;
+  nlohmann::json data;
+
+  REQUIRE(ctw.readFile("script/2.lua", text));
+  REQUIRE(text == "-- two");
+
+  // passed, archive is reopened:
+  REQUIRE(ctw.readFile("data.cbor", data));
+  REQUIRE(data["name"] == "cbor");
+  REQUIRE(ctw.readFile("script/1.lua", text));
+  REQUIRE(text == "-- one");
+
+  // first found:
+  REQUIRE(ctw.readFile("missing.json", "data.json", data));
+  REQUIRE(data["name"] == "json");
+
+  REQUIRE_FALSE(ctw.readFile("missing.json", data));
+  REQUIRE_FALSE(ctw.readFile("missing.lua", text));
+
+  // all files of a directory in one pass:
+  std::unordered_map<std::string, std::string> files;
+  ctw.readFiles("script", files);
+  REQUIRE(files.size() == 2);
+  REQUIRE(files["script/1.lua"] == "-- one");
+  REQUIRE(files["script/2.lua"] == "-- two");
+}
@@ -0,0 +1,140 @@
+/**
+ * server/test/world/worldjournal.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <fstream>
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldjournal.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/tile/rail/curve90railtile.hpp"
+#include "../../src/board/tile/rail/straightrailtile.hpp"
+
+TEST_CASE("WorldJournal: changes after save are replayed on load", "[world][world-journal]")
+{
+  std::filesystem::path ctw;
+  std::string keptBoardId;
+  std::string deletedBoardId;
+
+  {
+    auto world = World::create();
+    ctw = std::filesystem::temp_directory_path() / std::string(world->uuid.value()).append(World::dotCTW);
+
+    {
+      auto board = world->boards->create();
+      deletedBoardId = board->id;
+      REQUIRE(board->addTile(0, 0, TileRotate::Deg0, StraightRailTile::classId, false));
+    }
+
+    {
+      WorldSaver saver(*world, ctw);
+    }
+    world->startJournal(ctw, true);
+
+    // changes after the save:
+    world->name.setValueInternal("Journaled");
+
+    auto board = world->boards->create();
+    keptBoardId = board->id;
+    board->name.setValueInternal("Kept");
+    REQUIRE(board->addTile(1, 2, TileRotate::Deg270, Curve90RailTile::classId, false));
+
+    world->boards->delete_(world->boards->operator[](0));
+    REQUIRE(world->boards->length == 1);
+
+    world->save(); // writes journal
+  }
+
+  // simulate power loss during write:
+  {
+    std::ofstream journal(WorldJournal::filename(ctw), std::ios::app);
+    journal << "{\"put\":{\"id\":\"bo";
+  }
+
+  {
+    WorldLoader loader(ctw);
+    auto world = loader.world();
+    REQUIRE(world);
+
+    REQUIRE(world->name.value() == "Journaled");
+    REQUIRE(world->boards->length == 1);
+    REQUIRE_FALSE(world->getObjectById(deletedBoardId));
+
+    auto board = world->boards->operator[](0);
+    REQUIRE(board->id.value() == keptBoardId);
+    REQUIRE(board->name.value() == "Kept");
+
+    auto tile = board->getTile({1, 2});
+    REQUIRE(tile);
+    REQUIRE(tile->getClassId() == Curve90RailTile::classId);
+    REQUIRE(tile->rotate == TileRotate::Deg270);
+  }
+
+  REQUIRE(std::filesystem::remove(ctw));
+  REQUIRE(std::filesystem::remove(WorldJournal::filename(ctw)));
+}
+
+TEST_CASE("WorldJournal: id rename is replayed on load", "[world][world-journal]")
+{
+  std::filesystem::path ctw;
+  std::string oldBoardId;
+
+  {
+    auto world = World::create();
+    ctw = std::filesystem::temp_directory_path() / std::string(world->uuid.value()).append(World::dotCTW);
+
+    auto board = world->boards->create();
+    oldBoardId = board->id;
+    REQUIRE(board->addTile(0, 0, TileRotate::Deg0, StraightRailTile::classId, false));
+
+    {
+      WorldSaver saver(*world, ctw);
+    }
+    world->startJournal(ctw, true);
+
+    board->id.setValue("renamed_board");
+    REQUIRE(board->id.value() == "renamed_board");
+
+    world->save(); // writes journal
+  }
+
+  {
+    WorldLoader loader(ctw);
+    auto world = loader.world();
+    REQUIRE(world);
+
+    REQUIRE_FALSE(world->getObjectById(oldBoardId));
+    REQUIRE(world->boards->length == 1);
+
+    auto board = world->boards->operator[](0);
+    REQUIRE(board->id.value() == "renamed_board");
+    REQUIRE(world->getObjectById("renamed_board") == board);
+    REQUIRE(board->getTile({0, 0}));
+  }
+
+  REQUIRE(std::filesystem::remove(ctw));
+  REQUIRE(std::filesystem::remove(WorldJournal::filename(ctw)));
+}
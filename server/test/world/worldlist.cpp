@@ -0,0 +1,73 @@
+/**
+ * server/test/world/worldlist.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include <fstream>
+#include <boost/uuid/string_generator.hpp>
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldlist.hpp"
+#include "../../src/world/worldsaver.hpp"
+
+TEST_CASE("WorldList: index is used for unchanged worlds", "[world][worldlist]")
+{
+  const auto path = std::filesystem::temp_directory_path() / "traintastic-w5kq2r";
+  std::filesystem::create_directories(path);
+
+  std::string uuid;
+  {
+    auto world = World::create();
+    world->name.setValueInternal("Saved");
+    uuid = world->uuid.value();
+    WorldSaver saver(*world, path / uuid);
+  }
+
+  const auto indexFilename = path / "index.json";
+  {
+    WorldList worldList(path);
+    const auto* info = worldList.find(boost::uuids::string_generator()(uuid));
+    REQUIRE(info);
+    REQUIRE(info->name == "Saved");
+    REQUIRE(std::filesystem::is_regular_file(indexFilename));
+  }
+
+  // change the cached name, the world file isn't changed so the index must be used:
+  {
+    nlohmann::json index;
+    {
+      std::ifstream file(indexFilename);
+      index = nlohmann::json::parse(file);
+    }
+    REQUIRE(index[uuid]["name"] == "Saved");
+    index[uuid]["name"] = "Cached";
+    std::ofstream file(indexFilename);
+    file << index.dump();
+  }
+
+  {
+    WorldList worldList(path);
+    const auto* info = worldList.find(boost::uuids::string_generator()(uuid));
+    REQUIRE(info);
+    REQUIRE(info->name == "Cached");
+  }
+
+  std::filesystem::remove_all(path);
+}
@@ -0,0 +1,199 @@
+/**
+ * server/test/world/worldsaveload.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldjournal.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/tile/rail/straightrailtile.hpp"
+#include "../../src/lua/script.hpp"
+#include "../../src/lua/scriptlist.hpp"
+
+namespace {
+
+std::shared_ptr<World> createWorld(int boards, int16_t width, int16_t height)
+{
+  auto world = World::create();
+  for(int i = 0; i < boards; i++)
+  {
+    auto board = world->boards->create();
+    for(int16_t x = 0; x < width; x++)
+      for(int16_t y = 0; y < height; y++)
+        board->addTile(x, y, TileRotate::Deg0, StraightRailTile::classId, false);
+  }
+  return world;
+}
+
+void removeWorld(const std::filesystem::path& path)
+{
+  std::filesystem::remove_all(path);
+  std::filesystem::remove(WorldJournal::filename(path));
+}
+
+}
+
+TEST_CASE("World: Save/Load binary", "[world][world-saveload]")
+{
+  const bool ctw = GENERATE(false, true);
+
+  std::filesystem::path path;
+  std::string worldName;
+  {
+    auto world = createWorld(1, 2, 1);
+    world->name.setValueInternal("Binary");
+    path = std::filesystem::temp_directory_path() / world->uuid.value();
+    if(ctw)
+      path += World::dotCTW;
+    WorldSaver saver(*world, path, true);
+  }
+
+  if(!ctw)
+  {
+    REQUIRE(std::filesystem::is_regular_file(path / World::filenameBinary));
+    REQUIRE(std::filesystem::is_regular_file(path / World::filenameStateBinary));
+    REQUIRE_FALSE(std::filesystem::exists(path / World::filename));
+  }
+
+  {
+    WorldLoader loader(path);
+    auto world = loader.world();
+    REQUIRE(world);
+    REQUIRE(world->name.value() == "Binary");
+    REQUIRE(world->boards->length == 1);
+    auto board = world->boards->operator[](0);
+    REQUIRE(board->getTile({0, 0}));
+    REQUIRE(board->getTile({1, 0}));
+  }
+
+  removeWorld(path);
+}
+
+TEST_CASE("World: Save after change", "[world][world-saveload]")
+{
+  auto world = createWorld(2, 1, 1);
+  const auto path = std::filesystem::temp_directory_path() / world->uuid.value();
+
+  {
+    WorldSaver saver(*world, path); // fills save cache
+  }
+
+  auto board = world->boards->operator[](1);
+  board->name.setValueInternal("Changed");
+  REQUIRE(board->addTile(1, 0, TileRotate::Deg0, StraightRailTile::classId, false));
+
+  {
+    WorldSaver saver(*world, path);
+  }
+
+  {
+    WorldLoader loader(path);
+    auto loadedWorld = loader.world();
+    REQUIRE(loadedWorld);
+    REQUIRE(loadedWorld->boards->length == 2);
+    REQUIRE(loadedWorld->boards->operator[](0)->name.value() == world->boards->operator[](0)->name.value());
+    auto loadedBoard = loadedWorld->boards->operator[](1);
+    REQUIRE(loadedBoard->name.value() == "Changed");
+    REQUIRE(loadedBoard->getTile({0, 0}));
+    REQUIRE(loadedBoard->getTile({1, 0}));
+  }
+
+  removeWorld(path);
+}
+
+TEST_CASE("World: Snapshot links unchanged files", "[world][world-saveload]")
+{
+  auto world = createWorld(1, 1, 1);
+  auto unchanged = world->luaScripts->create();
+  auto changed = world->luaScripts->create();
+  unchanged->code.setValueInternal("log.info(1)");
+  changed->code.setValueInternal("log.info(2)");
+
+  const auto path = std::filesystem::temp_directory_path() / world->uuid.value();
+  auto previousPath = path;
+  previousPath += ".previous";
+
+  {
+    WorldSaver saver(*world, path, std::filesystem::path()); // fills save cache
+  }
+  std::filesystem::rename(path, previousPath); // backup, like a snapshot does
+
+  changed->code.setValueInternal("log.info(3)");
+
+  {
+    WorldSaver saver(*world, path, previousPath);
+  }
+
+  std::vector<uintmax_t> linkCounts;
+  for(const auto& entry : std::filesystem::recursive_directory_iterator(path))
+    if(entry.path().extension() == ".lua")
+      linkCounts.emplace_back(std::filesystem::hard_link_count(entry.path()));
+  std::sort(linkCounts.begin(), linkCounts.end());
+  REQUIRE(linkCounts == std::vector<uintmax_t>{1, 2}); // changed script is written, unchanged is linked
+
+  {
+    WorldLoader loader(path);
+    auto loadedWorld = loader.world();
+    REQUIRE(loadedWorld);
+    REQUIRE(loadedWorld->luaScripts->length == 2);
+    REQUIRE(loadedWorld->luaScripts->operator[](0)->code.value() == "log.info(1)");
+    REQUIRE(loadedWorld->luaScripts->operator[](1)->code.value() == "log.info(3)");
+  }
+
+  removeWorld(path);
+  removeWorld(previousPath);
+}
+
+TEST_CASE("World: Save/Load scripts", "[world][world-saveload]")
+{
+  const bool ctw = GENERATE(false, true);
+  const bool parallel = GENERATE(false, true);
+
+  std::filesystem::path path;
+  {
+    auto world = createWorld(1, 1, 1);
+    for(int i = 0; i < 3; i++)
+      world->luaScripts->create()->code.setValueInternal("log.info(" + std::to_string(i) + ")");
+    path = std::filesystem::temp_directory_path() / world->uuid.value();
+    if(ctw)
+      path += World::dotCTW;
+    WorldSaver saver(*world, path);
+  }
+
+  WorldLoader::parallel = parallel;
+  {
+    WorldLoader loader(path);
+    auto world = loader.world();
+    REQUIRE(world);
+    REQUIRE(world->boards->length == 1);
+    REQUIRE(world->luaScripts->length == 3);
+    for(uint32_t i = 0; i < world->luaScripts->length; i++)
+      REQUIRE(world->luaScripts->operator[](i)->code.value().rfind("log.info(", 0) == 0);
+  }
+  WorldLoader::parallel = true;
+
+  removeWorld(path);
+}
@@ -0,0 +1,84 @@
+/**
+ * server/test/world/worldstatecheckpoint.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch.hpp>
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldjournal.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/world/worldstatecheckpoint.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutleft45railtile.hpp"
+
+TEST_CASE("WorldStateCheckpoint: state changes after save are restored on load", "[world][world-state-checkpoint]")
+{
+  const bool ctw = GENERATE(false, true);
+
+  std::filesystem::path path;
+  {
+    auto world = World::create();
+    path = std::filesystem::temp_directory_path() / world->uuid.value();
+    if(ctw)
+      path += World::dotCTW;
+
+    auto board = world->boards->create();
+    REQUIRE(board->addTile(0, 0, TileRotate::Deg0, TurnoutLeft45RailTile::classId, false));
+    auto turnout = std::dynamic_pointer_cast<TurnoutRailTile>(board->getTile({0, 0}));
+    REQUIRE(turnout);
+
+    {
+      WorldSaver saver(*world, path);
+    }
+    world->startJournal(path, true);
+
+    // journaled, the record includes the turnout state at that moment:
+    turnout->name.setValueInternal("Journaled");
+    world->save();
+
+    // not journaled, written by the checkpoint:
+    turnout->position.setValueInternal(TurnoutPosition::Left);
+    world->save();
+
+    // the checkpoint doesn't touch the saved world:
+    REQUIRE(std::filesystem::is_regular_file(WorldStateCheckpoint::filename(path)));
+    if(!ctw)
+      REQUIRE_FALSE(WorldLoader::readWorldFile(path, World::filenameStateBinary, World::filenameState).contains("journal"));
+  }
+
+  {
+    WorldLoader loader(path);
+    auto world = loader.world();
+    REQUIRE(world);
+    REQUIRE(world->boards->length == 1);
+    auto turnout = std::dynamic_pointer_cast<TurnoutRailTile>(world->boards->operator[](0)->getTile({0, 0}));
+    REQUIRE(turnout);
+    REQUIRE(turnout->name.value() == "Journaled");
+    REQUIRE(turnout->position.value() == TurnoutPosition::Left);
+  }
+
+  std::filesystem::remove_all(path);
+  std::filesystem::remove(WorldJournal::filename(path));
+  std::filesystem::remove(WorldStateCheckpoint::filename(path));
+}
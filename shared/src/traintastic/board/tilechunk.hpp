@@ -0,0 +1,107 @@
+/**
+ * shared/src/traintastic/board/tilechunk.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SHARED_TRAINTASTIC_BOARD_TILECHUNK_HPP
+#define TRAINTASTIC_SHARED_TRAINTASTIC_BOARD_TILECHUNK_HPP
+
+#include "tilelocation.hpp"
+#include "tiledata.hpp"
+
+//! \brief Square part of a board, boards are transferred to clients in chunks
+//!
+//! A tile belongs to the chunk its origin is in.
+struct TileChunk
+{
+  static constexpr int size = 16; //!< chunk width and height in tiles
+
+  int16_t x;
+  int16_t y;
+
+  static constexpr int16_t fromTile(int tile)
+  {
+    return static_cast<int16_t>(tile >= 0 ? tile / size : -((size - 1 - tile) / size));
+  }
+
+  static constexpr TileChunk fromLocation(const TileLocation& l)
+  {
+    return {fromTile(l.x), fromTile(l.y)};
+  }
+
+  constexpr int left() const { return x * size; }
+  constexpr int top() const { return y * size; }
+
+  bool operator ==(const TileChunk& other) const
+  {
+    return x == other.x && y == other.y;
+  }
+
+  bool operator !=(const TileChunk& other) const
+  {
+    return !(*this == other);
+  }
+};
+
+//! \brief Rectangle of chunks, a client's board viewport
+struct TileChunkRect
+{
+  TileChunk min; //!< inclusive
+  TileChunk max; //!< inclusive
+
+  //! \brief Chunks needed to show the tiles in the rectangle
+  //!
+  //! Includes one chunk left and above, for tiles with their origin outside
+  //! the rectangle but large enough to reach into it.
+  static constexpr TileChunkRect fromTiles(int left, int top, int right, int bottom)
+  {
+    static_assert(TileData::widthMax <= TileChunk::size && TileData::heightMax <= TileChunk::size);
+    return {
+      {static_cast<int16_t>(TileChunk::fromTile(left) - 1), static_cast<int16_t>(TileChunk::fromTile(top) - 1)},
+      {TileChunk::fromTile(right), TileChunk::fromTile(bottom)}};
+  }
+
+  constexpr bool isEmpty() const
+  {
+    return max.x < min.x || max.y < min.y;
+  }
+
+  constexpr bool contains(const TileChunk& chunk) const
+  {
+    return chunk.x >= min.x && chunk.x <= max.x && chunk.y >= min.y && chunk.y <= max.y;
+  }
+
+  constexpr bool contains(const TileLocation& l) const
+  {
+    return contains(TileChunk::fromLocation(l));
+  }
+
+  bool operator ==(const TileChunkRect& other) const
+  {
+    return min == other.min && max == other.max;
+  }
+
+  bool operator !=(const TileChunkRect& other) const
+  {
+    return !(*this == other);
+  }
+};
+
+#endif
@@ -114,13 +114,14 @@ enum class LogMessage : uint32_t
   N1019_MUTE_DISABLED = LogMessageOffset::notice + 1019,
   N1020_SMOKE_ENABLED = LogMessageOffset::notice + 1020,
   N1021_SMOKE_DISABLED = LogMessageOffset::notice + 1021,
-  N1022_SAVED_WORLD_X = LogMessageOffset::notice + 1022,
+  N1022_SAVED_WORLD_X_IN_X_MS = LogMessageOffset::notice + 1022,
   N1023_SIMULATION_DISABLED = LogMessageOffset::notice + 1023,
   N1024_SIMULATION_ENABLED = LogMessageOffset::notice + 1024,
   N1025_EXPORTED_WORLD_SUCCESSFULLY = LogMessageOffset::notice + 1025,
   N1026_IMPORTED_WORLD_SUCCESSFULLY = LogMessageOffset::notice + 1026,
   N1027_LOADED_WORLD_X = LogMessageOffset::notice + 1027,
   N1028_CLOSED_WORLD = LogMessageOffset::notice + 1028,
+  N1029_APPLIED_X_JOURNALED_WORLD_CHANGES = LogMessageOffset::notice + 1029,
   N2001_SIMULATION_NOT_SUPPORTED = LogMessageOffset::notice + 2001,
   N2002_NO_RESPONSE_FROM_LNCV_MODULE_X_WITH_ADDRESS_X = LogMessageOffset::notice + 2002,
   N2003_STOPPED_SENDING_FAST_CLOCK_SYNC = LogMessageOffset::notice + 2003,
@@ -137,6 +138,8 @@ enum class LogMessage : uint32_t
   W1001_DISCOVERY_DISABLED_ONLY_ALLOWED_ON_PORT_X = LogMessageOffset::warning + 1001,
   W1002_SETTING_X_DOESNT_EXIST = LogMessageOffset::warning + 1002,
   W1003_READING_WORLD_X_FAILED_LIBARCHIVE_ERROR_X_X = LogMessageOffset::warning + 1003,
+  W1004_EVENT_LOOP_HANDLER_TOOK_X_MS = LogMessageOffset::warning + 1004,
+  W1005_WRITE_BACKLOG_EXCEEDS_X_BYTES_DISCONNECTING = LogMessageOffset::warning + 1005,
   W2001_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES = LogMessageOffset::warning + 2001,
   W2002_COMMAND_STATION_DOESNT_SUPPORT_FUNCTIONS_ABOVE_FX = LogMessageOffset::warning + 2002,
   W2003_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES_X = LogMessageOffset::warning + 2003,
@@ -144,6 +147,7 @@ enum class LogMessage : uint32_t
   W2005_OUTPUT_ADDRESS_X_IS_INVALID = LogMessageOffset::warning + 2005,
   W2006_COMMAND_STATION_DOES_NOT_SUPPORT_LOCO_SLOT_X = LogMessageOffset::warning + 2006,
   W2007_COMMAND_STATION_DOES_NOT_SUPPORT_THE_FAST_CLOCK_SLOT = LogMessageOffset::warning + 2007,
+  W2008_PINNING_KERNEL_THREAD_X_TO_CPU_X_FAILED = LogMessageOffset::warning + 2008,
   W2018_TIMEOUT_NO_ECHO_WITHIN_X_MS = LogMessageOffset::warning + 2018,
   W2019_Z21_BROADCAST_FLAG_MISMATCH = LogMessageOffset::warning + 2019,
   W3001_NX_BUTTON_CONNECTED_TO_TWO_BLOCKS = LogMessageOffset::warning + 3001,
@@ -160,6 +164,8 @@ enum class LogMessage : uint32_t
   E1006_SOCKET_WRITE_FAILED_X = LogMessageOffset::error + 1006,
   E1007_SOCKET_READ_FAILED_X = LogMessageOffset::error + 1007,
   E1008_SOCKET_ACCEPTOR_CANCEL_FAILED_X = LogMessageOffset::error + 1008,
+  E1009_WRITING_WORLD_JOURNAL_FAILED_X = LogMessageOffset::error + 1009,
+  E1010_WRITING_WORLD_STATE_CHECKPOINT_FAILED_X = LogMessageOffset::error + 1010,
   E2001_SERIAL_WRITE_FAILED_X = LogMessageOffset::error + 2001,
   E2002_SERIAL_READ_FAILED_X = LogMessageOffset::error + 2002,
   E2003_MAKE_ADDRESS_FAILED_X = LogMessageOffset::error + 2003,
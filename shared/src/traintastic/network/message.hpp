@@ -25,18 +25,22 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <atomic>
 #include <memory>
 #include <stack>
 #include <cstdint>
 #include <cstring>
 #include <cassert>
+#include <algorithm>
 #ifdef QT_CORE_LIB
   #include <QByteArray>
+  #include <QString>
   #include <QUuid>
 #endif
 
 #include "../enum/logmessage.hpp"
+#include "messagebufferpool.hpp"
 
 class Message
 {
@@ -52,6 +56,7 @@ class Message
       ExportWorld = 10,
       CreateObject = 11,
       GetObject = 14,
+      GetObjects = 46, //!< get multiple objects by id using a single request
       ReleaseObject = 15,
       ObjectSetProperty = 16,
       ObjectSetUnitPropertyUnit = 26,
@@ -68,6 +73,8 @@ class Message
       TableModelRowCountChanged = 22,
       TableModelSetRegion = 23,
       TableModelUpdateRegion = 24,
+      TableModelSetSortFilter = 47, //!< sort and/or filter the rows on the server
+      TableModelRowsChanged = 48, //!< rows inserted, removed or moved, see \ref TableModelRowChange
 
       InputMonitorGetInputInfo = 30,
       InputMonitorInputIdChanged = 31,
@@ -81,6 +88,8 @@ class Message
       BoardGetTileData = 37,
       BoardTileDataChanged = 38,
       BoardGetTileInfo = 43,
+      BoardSetViewport = 49, //!< only send tile data changes within the viewport, see \ref TileChunkRect
+      BoardGetTileChunks = 50, //!< get tile data of chunks, see \ref TileChunk
 
       OutputMapGetItems = 39,
       OutputMapGetOutputs = 40,
@@ -106,7 +115,8 @@ class Message
       Command command;
       struct Flags
       {
-        uint8_t reserved : 5; // must be zero
+        uint8_t reserved : 4; // must be zero
+        uint8_t compressed : 1; //!< data is compressed, see \ref featureCompression
         uint8_t error : 1;
         uint8_t type : 2;
       } flags;
@@ -122,13 +132,29 @@ class Message
 #endif
     static_assert(sizeof(Header) == 8);
 
+    //! Protocol features, the client sends the features it supports in the login request,
+    //! the server responds with the features that are enabled for the connection.
+    using Features = uint32_t;
+
+    //! Large messages may be sent compressed (server to client only), the data of a compressed
+    //! message is the uncompressed data size (uint32, big endian) followed by a zlib stream.
+    //! This is the same format as used by qCompress/qUncompress.
+    static constexpr Features featureCompression = 0x00000001;
+
   private:
     inline static std::atomic<uint16_t> s_requestId{0};
 
   protected:
     std::vector<uint8_t> m_data;
     mutable uint32_t m_readPosition;
-    mutable std::stack<uint32_t> m_block;
+    mutable std::stack<uint32_t, std::vector<uint32_t>> m_block; // vector doesn't allocate until used, deque does
+
+    std::vector<uint8_t> acquireBuffer(size_t size, size_t capacity = 0)
+    {
+      std::vector<uint8_t> buffer = bufferPool.acquire(std::max(size, capacity));
+      buffer.resize(size);
+      return buffer;
+    }
 
     const Header& header() const { return *reinterpret_cast<const Header*>(m_data.data()); }
     Header& header() { return *reinterpret_cast<Header*>(m_data.data()); }
@@ -141,6 +167,8 @@ class Message
   public:
     using Length = uint32_t;
 
+    inline static MessageBufferPool bufferPool;
+
     static std::unique_ptr<Message> newRequest(Command command, size_t capacity = 0)
     {
       return std::make_unique<Message>(command, Type::Request, ++s_requestId, capacity);
@@ -189,35 +217,34 @@ class Message
     }
 
     Message(const Header& _header) :
-      m_data(sizeof(Header) + _header.dataSize, 0),
+      m_data(acquireBuffer(sizeof(Header) + _header.dataSize)),
       m_readPosition{0}
     {
       header() = _header;
     }
 
     Message(Command command, Type type, uint16_t requestId, size_t capacity = 0) :
-      m_data(sizeof(Header), 0),
+      m_data(acquireBuffer(sizeof(Header), sizeof(Header) + capacity)),
       m_readPosition{0}
     {
       header().command = command;
       header().flags.reserved = 0;
+      header().flags.compressed = 0;
       header().flags.error = 0;
       header().flags.type = static_cast<uint8_t>(type);
       header().requestId = requestId;
       header().dataSize = 0;
-
-      if(capacity > 0)
-        m_data.reserve(sizeof(Header) + capacity);
     }
 
     Message(uint32_t size) :
-      m_data(size, 0),
+      m_data(acquireBuffer(size)),
       m_readPosition{0}
     {
     }
 
     ~Message()
     {
+      bufferPool.release(std::move(m_data));
     }
 
     inline Command command() const { return header().command; }
@@ -226,6 +253,7 @@ class Message
     inline bool isResponse() const  { return type() == Type::Response; }
     inline bool isEvent() const { return type() == Type::Event; }
     inline bool isError() const { return header().flags.error; }
+    inline bool isCompressed() const { return header().flags.compressed; }
     inline uint16_t requestId() const { return header().requestId; }
 
     const void* operator*() const { return m_data.data(); }
@@ -256,6 +284,12 @@ class Message
         memcpy(value.data(), p + sizeof(Length), length);
         m_readPosition += length;
       }
+      else if constexpr(std::is_same_v<T,QString>) // UTF-8 decoded directly from the message data
+      {
+        const Length length = read<Length>();
+        value = QString::fromUtf8(reinterpret_cast<const char*>(p + sizeof(Length)), static_cast<int>(length));
+        m_readPosition += length;
+      }
       else
 #endif
       if constexpr(std::is_same_v<T,bool>)
@@ -270,6 +304,12 @@ class Message
         memcpy(value.data(), p + sizeof(Length), length);
         m_readPosition += length;
       }
+      else if constexpr(std::is_same_v<T,std::string_view>) // borrows from the message data, only valid while the message exists
+      {
+        const Length length = read<Length>();
+        value = {reinterpret_cast<const char*>(p + sizeof(Length)), length};
+        m_readPosition += length;
+      }
       else if constexpr(std::is_trivially_copyable_v<T>)
       {
         memcpy(&value, p, sizeof(value));
@@ -0,0 +1,88 @@
+/**
+ * shared/src/traintastic/network/messagebufferpool.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SHARED_TRAINTASTIC_NETWORK_MESSAGEBUFFERPOOL_HPP
+#define TRAINTASTIC_SHARED_TRAINTASTIC_NETWORK_MESSAGEBUFFERPOOL_HPP
+
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+/**
+ * \brief Pool of message buffers
+ *
+ * Buffers of destroyed messages are kept for reuse, so sending and receiving messages
+ * doesn't require a heap allocation for the message data in the common case.
+ *
+ * \note Thread safe, messages are usually created and destroyed in different threads.
+ */
+class MessageBufferPool
+{
+  private:
+    std::mutex m_mutex;
+    std::vector<std::vector<uint8_t>> m_buffers;
+
+  public:
+    //! Maximum number of buffers kept for reuse.
+    static constexpr size_t buffersMax = 256;
+
+    //! Buffers with a larger capacity are not kept for reuse.
+    static constexpr size_t capacityMax = 64 * 1024;
+
+    //! \brief Get an empty buffer, with at least \p capacity reserved
+    std::vector<uint8_t> acquire(size_t capacity)
+    {
+      std::vector<uint8_t> buffer;
+      if(capacity <= capacityMax) // a large buffer wouldn't be kept for reuse anyway
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_buffers.empty())
+        {
+          buffer = std::move(m_buffers.back());
+          m_buffers.pop_back();
+        }
+      }
+      buffer.reserve(capacity);
+      return buffer;
+    }
+
+    //! \brief Return a buffer to the pool
+    void release(std::vector<uint8_t>&& buffer)
+    {
+      if(buffer.capacity() == 0 || buffer.capacity() > capacityMax)
+        return;
+
+      buffer.clear();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(m_buffers.size() < buffersMax)
+        m_buffers.emplace_back(std::move(buffer));
+    }
+
+    //! \brief Number of buffers available for reuse
+    size_t size()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_buffers.size();
+    }
+};
+
+#endif